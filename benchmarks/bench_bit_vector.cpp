@@ -0,0 +1,110 @@
+// Memory and scan throughput of the packed BitVector against the
+// byte-per-flag Vector<bool> layout.
+
+#include "BitVector.h"
+#include "Vector.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+template <typename F>
+double time_ms(F&& f, int repeats = 3) {
+    double best = 1e300;
+    for (int r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        best = elapsed.count() < best ? elapsed.count() : best;
+    }
+    return best;
+}
+
+volatile size_t sink;
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+    size_t stride = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 97; // Density of set bits
+
+    CustomCXX::Vector<bool> bytes(n);
+    CustomCXX::BitVector bits(n);
+    CustomCXX::Vector<bool> bytes_mask(n);
+    CustomCXX::BitVector bits_mask(n);
+    bool* flag = bytes.begin();
+    bool* mask_flag = bytes_mask.begin();
+    for (size_t i = 0; i < n; i += stride) {
+        flag[i] = true;
+        bits.set(i);
+    }
+    for (size_t i = 0; i < n; i += 3) {
+        mask_flag[i] = true;
+        bits_mask.set(i);
+    }
+
+    std::printf("%zu flags, one set every %zu\n\n", n, stride);
+    std::printf("%-28s %14s %14s\n", "", "Vector<bool>", "BitVector");
+    std::printf("%-28s %11.1f MB %11.1f MB\n", "memory", bytes.capacity() / 1e6, bits.capacity() / 8 / 1e6);
+
+    double byte_count = time_ms([&]() {
+        size_t total = 0;
+        const bool* f = bytes.begin();
+        for (size_t i = 0; i < n; ++i) {
+            total += f[i];
+        }
+        sink = total;
+    });
+    double bit_count = time_ms([&]() { sink = bits.count(); });
+    std::printf("%-28s %11.2f ms %11.2f ms  (x%.1f)\n", "count()", byte_count, bit_count, byte_count / bit_count);
+
+    double byte_scan = time_ms([&]() {
+        size_t visited = 0;
+        const bool* f = bytes.begin();
+        for (size_t i = 0; i < n; ++i) {
+            if (f[i]) {
+                visited += i;
+            }
+        }
+        sink = visited;
+    });
+    double bit_scan = time_ms([&]() {
+        size_t visited = 0;
+        for (size_t i = bits.find_first(); i != CustomCXX::BitVector::npos; i = bits.find_next(i)) {
+            visited += i;
+        }
+        sink = visited;
+    });
+    std::printf("%-28s %11.2f ms %11.2f ms  (x%.1f)\n", "set-bit scan", byte_scan, bit_scan, byte_scan / bit_scan);
+
+    double byte_and = time_ms([&]() {
+        bool* f = bytes.begin();
+        const bool* m = bytes_mask.begin();
+        for (size_t i = 0; i < n; ++i) {
+            f[i] = f[i] & !m[i];
+        }
+    });
+    double bit_and = time_ms([&]() { bits.and_not(bits_mask); });
+    std::printf("%-28s %11.2f ms %11.2f ms  (x%.1f)\n", "and-not with a mask", byte_and, bit_and, byte_and / bit_and);
+
+    bits.build_rank_index();
+    double rank_time = time_ms([&]() {
+        size_t total = 0;
+        for (size_t i = 0; i < 1000000; ++i) {
+            total += bits.rank((i * 2654435761u) % n);
+        }
+        sink = total;
+    });
+    size_t ones = bits.count();
+    double select_time = time_ms([&]() {
+        size_t total = 0;
+        for (size_t i = 0; ones && i < 1000000; ++i) {
+            total += bits.select((i * 2654435761u) % ones);
+        }
+        sink = total;
+    });
+    std::printf("\n%-28s %11.1f ns/op\n", "rank (indexed)", rank_time * 1e6 / 1000000);
+    std::printf("%-28s %11.1f ns/op\n", "select (indexed)", select_time * 1e6 / 1000000);
+    return 0;
+}
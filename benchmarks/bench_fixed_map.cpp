@@ -0,0 +1,107 @@
+// Lookup cost of a compile-time FixedMap against a Map loaded at startup,
+// for the small enum/string tables they are meant to replace.
+
+#include "FixedMap.h"
+#include "Map.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+namespace {
+
+enum class Opcode { Nop, Load, Store, Add, Sub, Mul, Div, Mod, And, Or, Xor, Shl, Shr, Jump, Call, Ret };
+constexpr size_t opcode_count = 16;
+
+constexpr CustomCXX::FixedMap<Opcode, int, opcode_count> fixed_costs = {
+    {Opcode::Nop, 1},  {Opcode::Load, 3}, {Opcode::Store, 3}, {Opcode::Add, 1}, {Opcode::Sub, 1},  {Opcode::Mul, 3},
+    {Opcode::Div, 20}, {Opcode::Mod, 20}, {Opcode::And, 1},   {Opcode::Or, 1},  {Opcode::Xor, 1},  {Opcode::Shl, 1},
+    {Opcode::Shr, 1},  {Opcode::Jump, 2}, {Opcode::Call, 5},  {Opcode::Ret, 5},
+};
+
+constexpr CustomCXX::FixedMap<std::string_view, int, opcode_count> fixed_mnemonics = {
+    {"nop", 0},  {"load", 1}, {"store", 2}, {"add", 3},  {"sub", 4},  {"mul", 5},   {"div", 6},  {"mod", 7},
+    {"and", 8},  {"or", 9},   {"xor", 10},  {"shl", 11}, {"shr", 12}, {"jump", 13}, {"call", 14}, {"ret", 15},
+};
+
+constexpr std::string_view mnemonic_list[opcode_count] = {
+    "nop", "load", "store", "add", "sub", "mul", "div", "mod", "and", "or", "xor", "shl", "shr", "jump", "call", "ret",
+};
+
+template <typename F>
+double time_ns_per_op(size_t ops, F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(ops);
+}
+
+volatile long long sink;
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t lookups = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000000;
+
+    // Pseudo-random query stream so the branch predictor cannot learn it
+    const size_t stream_size = 4096;
+    unsigned queries[stream_size];
+    unsigned state = 12345;
+    for (size_t i = 0; i < stream_size; ++i) {
+        state = state * 1103515245u + 12345u;
+        queries[i] = (state >> 16) % opcode_count;
+    }
+
+    double map_build = time_ns_per_op(1, [&]() {
+        CustomCXX::Map<int, int> map;
+        for (size_t i = 0; i < opcode_count; ++i) {
+            map.insert_or_assign(static_cast<int>(i), fixed_costs.at(static_cast<Opcode>(i)));
+        }
+        sink = map.size();
+    });
+
+    CustomCXX::Map<int, int> map_costs;
+    CustomCXX::Map<std::string_view, int> map_mnemonics;
+    for (size_t i = 0; i < opcode_count; ++i) {
+        map_costs.insert_or_assign(static_cast<int>(i), fixed_costs.at(static_cast<Opcode>(i)));
+        map_mnemonics.insert_or_assign(mnemonic_list[i], static_cast<int>(i));
+    }
+
+    double map_int = time_ns_per_op(lookups, [&]() {
+        long long acc = 0;
+        for (size_t i = 0; i < lookups; ++i) {
+            acc += map_costs[static_cast<int>(queries[i % stream_size])];
+        }
+        sink = acc;
+    });
+    double fixed_int = time_ns_per_op(lookups, [&]() {
+        long long acc = 0;
+        for (size_t i = 0; i < lookups; ++i) {
+            acc += fixed_costs.at(static_cast<Opcode>(queries[i % stream_size]));
+        }
+        sink = acc;
+    });
+    double map_str = time_ns_per_op(lookups, [&]() {
+        long long acc = 0;
+        for (size_t i = 0; i < lookups; ++i) {
+            acc += map_mnemonics[mnemonic_list[queries[i % stream_size]]];
+        }
+        sink = acc;
+    });
+    double fixed_str = time_ns_per_op(lookups, [&]() {
+        long long acc = 0;
+        for (size_t i = 0; i < lookups; ++i) {
+            acc += fixed_mnemonics.at(mnemonic_list[queries[i % stream_size]]);
+        }
+        sink = acc;
+    });
+
+    std::printf("%zu-entry tables, %zu lookups\n\n", opcode_count, lookups);
+    std::printf("%-32s %10.0f ns (FixedMap: 0, built by the compiler)\n", "Map startup build", map_build);
+    std::printf("%-32s %10.2f ns/lookup\n", "Map<int, int>", map_int);
+    std::printf("%-32s %10.2f ns/lookup  (x%.2f)\n", "FixedMap<enum, int>", fixed_int, map_int / fixed_int);
+    std::printf("%-32s %10.2f ns/lookup\n", "Map<string_view, int>", map_str);
+    std::printf("%-32s %10.2f ns/lookup  (x%.2f)\n", "FixedMap<string_view, int>", fixed_str, map_str / fixed_str);
+    std::printf("\nsizeof(FixedMap<enum, int, 16>) = %zu bytes of read-only data\n", sizeof(fixed_costs));
+    return 0;
+}
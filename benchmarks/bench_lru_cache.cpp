@@ -0,0 +1,221 @@
+// Hit rate and throughput of cache-aside lookups on Zipf-distributed keys:
+// the hand-rolled Map + List cache, std::unordered_map + std::list, LruCache
+// under LRU and Clock, and ShardedLruCache across threads.
+
+#include "List.h"
+#include "LruCache.h"
+#include "Map.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+template <typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+// Keys in [0, universe) drawn with P(k) proportional to 1 / (k + 1)^skew
+std::vector<int> zipf_trace(size_t universe, double skew, size_t length, unsigned seed) {
+    std::vector<double> cdf(universe);
+    double total = 0;
+    for (size_t k = 0; k < universe; ++k) {
+        total += 1.0 / std::pow(static_cast<double>(k + 1), skew);
+        cdf[k] = total;
+    }
+
+    // Scatter the popular keys so they do not share low bits; the same
+    // permutation for every seed, so all traces agree on which keys are hot
+    std::vector<int> permutation(universe);
+    for (size_t k = 0; k < universe; ++k) {
+        permutation[k] = static_cast<int>(k);
+    }
+    std::mt19937_64 shuffle_rng(0);
+    std::shuffle(permutation.begin(), permutation.end(), shuffle_rng);
+
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> uniform(0, total);
+    std::vector<int> trace(length);
+    for (auto& key : trace) {
+        size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+        key = permutation[std::min(rank, universe - 1)];
+    }
+    return trace;
+}
+
+int load(int key) {
+    return key * 3 + 1; // Stands in for the expensive fetch a cache avoids
+}
+
+// The pattern LruCache replaces: values in a Map, recency in a List of keys
+struct HandRolledCache {
+    CustomCXX::Map<int, int> values;
+    CustomCXX::List<int> recency; // Most recent first
+    size_t capacity;
+
+    explicit HandRolledCache(size_t capacity) : values(capacity * 2), capacity(capacity) {}
+
+    bool get_or_load(int key, int& out) {
+        if (values.contains(key)) {
+            size_t index = 0;
+            for (auto node = recency.begin(); node->value != key; node = node->next) {
+                ++index; // O(n): List only erases by position
+            }
+            recency.erase(index);
+            recency.push_front(key);
+            out = values.at(key);
+            return true;
+        }
+        if (recency.size() == capacity) {
+            values.erase(recency.back());
+            recency.pop_back();
+        }
+        out = load(key);
+        values.insert_or_assign(key, out);
+        recency.push_front(key);
+        return false;
+    }
+};
+
+struct StdCache {
+    std::list<std::pair<int, int>> recency;
+    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index;
+    size_t capacity;
+
+    explicit StdCache(size_t capacity) : capacity(capacity) {
+        index.reserve(capacity * 2);
+    }
+
+    bool get_or_load(int key, int& out) {
+        auto found = index.find(key);
+        if (found != index.end()) {
+            recency.splice(recency.begin(), recency, found->second);
+            out = found->second->second;
+            return true;
+        }
+        if (recency.size() == capacity) {
+            index.erase(recency.back().first);
+            recency.pop_back();
+        }
+        out = load(key);
+        recency.emplace_front(key, out);
+        index[key] = recency.begin();
+        return false;
+    }
+};
+
+struct CustomCache {
+    CustomCXX::LruCache<int, int> cache;
+
+    CustomCache(size_t capacity, CustomCXX::EvictionPolicy policy) : cache(capacity, policy) {}
+
+    bool get_or_load(int key, int& out) {
+        if (int* value = cache.get(key)) {
+            out = *value;
+            return true;
+        }
+        out = load(key);
+        cache.put(key, out);
+        return false;
+    }
+};
+
+volatile long long sink;
+
+template <typename Cache>
+void run(const char* name, Cache& cache, const std::vector<int>& trace, size_t ops) {
+    size_t hits = 0;
+    long long acc = 0;
+    double t = time_ms([&]() {
+        for (size_t i = 0; i < ops; ++i) {
+            int value;
+            hits += cache.get_or_load(trace[i], value);
+            acc += value;
+        }
+    });
+    sink = acc;
+    std::printf("%-30s %9.2f%% %12.2f\n", name, 100.0 * hits / ops, ops / t / 1e3);
+}
+
+void run_sharded(CustomCXX::EvictionPolicy policy, size_t capacity, size_t threads,
+                 const std::vector<std::vector<int>>& traces) {
+    CustomCXX::ShardedLruCache<int, int> cache(capacity, 64, policy);
+    std::vector<size_t> hits(threads);
+    double t = time_ms([&]() {
+        std::vector<std::thread> workers;
+        for (size_t w = 0; w < threads; ++w) {
+            workers.emplace_back([&, w]() {
+                size_t local = 0;
+                for (int key : traces[w]) {
+                    if (cache.get(key)) {
+                        ++local;
+                    } else {
+                        cache.put(key, load(key));
+                    }
+                }
+                hits[w] = local;
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    });
+
+    size_t total_hits = 0, total_ops = 0;
+    for (size_t w = 0; w < threads; ++w) {
+        total_hits += hits[w];
+        total_ops += traces[w].size();
+    }
+    char name[64];
+    std::snprintf(name, sizeof(name), "Sharded %s, %zu threads", policy == CustomCXX::EvictionPolicy::Clock ? "Clock" : "LRU", threads);
+    std::printf("%-30s %9.2f%% %12.2f\n", name, 100.0 * total_hits / total_ops, total_ops / t / 1e3);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t universe = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t capacity = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10000;
+    double skew = argc > 3 ? std::atof(argv[3]) : 0.99;
+    size_t ops = 4000000;
+
+    std::vector<int> trace = zipf_trace(universe, skew, ops, 1);
+    std::printf("%zu keys, Zipf skew %.2f, capacity %zu, %zu lookups\n\n", universe, skew, capacity, ops);
+    std::printf("%-30s %10s %12s\n", "cache", "hit rate", "Mops/s");
+
+    // The O(n) touch makes the hand-rolled cache too slow for the full trace
+    HandRolledCache hand_rolled(capacity);
+    run("Map + List (hand-rolled)", hand_rolled, trace, std::min<size_t>(ops, 20000));
+
+    StdCache std_cache(capacity);
+    run("std::unordered_map + list", std_cache, trace, ops);
+
+    CustomCache lru(capacity, CustomCXX::EvictionPolicy::LRU);
+    run("LruCache (LRU)", lru, trace, ops);
+
+    CustomCache clock(capacity, CustomCXX::EvictionPolicy::Clock);
+    run("LruCache (Clock)", clock, trace, ops);
+
+    std::printf("\n");
+    size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        std::vector<std::vector<int>> traces;
+        for (size_t w = 0; w < threads; ++w) {
+            traces.push_back(zipf_trace(universe, skew, ops / threads, static_cast<unsigned>(w + 2)));
+        }
+        run_sharded(CustomCXX::EvictionPolicy::LRU, capacity, threads, traces);
+        run_sharded(CustomCXX::EvictionPolicy::Clock, capacity, threads, traces);
+    }
+    return 0;
+}
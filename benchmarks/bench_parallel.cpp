@@ -0,0 +1,113 @@
+// Scaling of the parallel Vector algorithms with thread count, against a
+// serial loop and (when available) std::execution::par.
+
+#include "Parallel.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#ifdef CUSTOMCXX_HAVE_STD_PAR
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include <vector>
+#endif
+
+namespace {
+
+template <typename F>
+double time_ms(F&& f, int repeats = 5) {
+    double best = 1e300;
+    for (int r = 0; r < repeats; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        best = elapsed.count() < best ? elapsed.count() : best;
+    }
+    return best;
+}
+
+// A few dozen flops per element, roughly a "scoring" pass
+inline double score(double x) {
+    return std::sqrt(x) * std::sin(x) + std::log1p(x);
+}
+
+volatile double sink;
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+    size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::thread::hardware_concurrency();
+    if (max_threads == 0) {
+        max_threads = 1;
+    }
+
+    CustomCXX::Vector<double> input(n);
+    for (size_t i = 0; i < n; ++i) {
+        input[i] = static_cast<double>(i % 1000);
+    }
+
+    std::printf("elements: %zu, max threads: %zu\n\n", n, max_threads);
+    std::printf("%-28s %8s %12s\n", "variant", "threads", "ms");
+
+    double serial_transform = time_ms([&]() {
+        CustomCXX::Vector<double> out(n);
+        double* dst = out.begin();
+        const double* src = &input[0];
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = score(src[i]);
+        }
+        sink = dst[n / 2];
+    });
+    double serial_reduce = time_ms([&]() {
+        double acc = 0;
+        const double* src = &input[0];
+        for (size_t i = 0; i < n; ++i) {
+            acc += score(src[i]);
+        }
+        sink = acc;
+    });
+    std::printf("%-28s %8d %12.2f\n", "serial transform", 1, serial_transform);
+    std::printf("%-28s %8d %12.2f\n", "serial map-reduce", 1, serial_reduce);
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+        CustomCXX::ThreadPool pool(threads - 1); // The caller is the last thread
+        double t = time_ms([&]() {
+            auto out = CustomCXX::parallel_transform(pool, input, [](const double& x) { return score(x); });
+            sink = out[n / 2];
+        });
+        double r = time_ms([&]() {
+            auto scores = CustomCXX::parallel_transform(pool, input, [](const double& x) { return score(x); });
+            sink = CustomCXX::parallel_reduce(pool, scores, 0.0, [](double a, double b) { return a + b; });
+        });
+        double f = time_ms([&]() {
+            auto kept = CustomCXX::parallel_filter(pool, input, [](const double& x) { return score(x) > 10.0; });
+            sink = static_cast<double>(kept.size());
+        });
+        std::printf("%-28s %8zu %12.2f  (x%.2f)\n", "parallel_transform", threads, t, serial_transform / t);
+        std::printf("%-28s %8zu %12.2f  (x%.2f)\n", "parallel_transform+reduce", threads, r, serial_reduce / r);
+        std::printf("%-28s %8zu %12.2f\n", "parallel_filter", threads, f);
+    }
+
+#ifdef CUSTOMCXX_HAVE_STD_PAR
+    std::vector<double> std_input(&input[0], &input[0] + n);
+    std::vector<double> std_output(n);
+    double std_t = time_ms([&]() {
+        std::transform(std::execution::par, std_input.begin(), std_input.end(), std_output.begin(),
+                       [](double x) { return score(x); });
+        sink = std_output[n / 2];
+    });
+    double std_r = time_ms([&]() {
+        sink = std::transform_reduce(std::execution::par, std_input.begin(), std_input.end(), 0.0,
+                                     std::plus<double>(), [](double x) { return score(x); });
+    });
+    std::printf("%-28s %8zu %12.2f  (x%.2f)\n", "std::execution::par transform", max_threads, std_t, serial_transform / std_t);
+    std::printf("%-28s %8zu %12.2f  (x%.2f)\n", "std::execution::par reduce", max_threads, std_r, serial_reduce / std_r);
+#else
+    std::printf("\nstd::execution::par not available (no TBB found at configure time)\n");
+#endif
+    return 0;
+}
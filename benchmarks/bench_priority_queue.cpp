@@ -0,0 +1,176 @@
+// Scheduler ticks and push/pop mixes: d-ary PriorityQueue against
+// std::priority_queue and the sort-after-every-batch approach.
+
+#include "PriorityQueue.h"
+#include "Vector.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace {
+
+template <typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+volatile long long sink;
+
+// Each tick schedules `batch` timers due within `horizon` ticks, then fires
+// every timer that is due. Returns the number fired.
+template <typename Queue>
+long long run_ticks(Queue& queue, const std::vector<long long>& delays, size_t ticks, size_t batch) {
+    long long fired = 0;
+    size_t next = 0;
+    for (long long now = 0; now < static_cast<long long>(ticks); ++now) {
+        for (size_t i = 0; i < batch; ++i) {
+            queue.push(now + delays[next++ % delays.size()]);
+        }
+        while (!queue.empty() && queue.top() <= now) {
+            queue.pop();
+            ++fired;
+        }
+    }
+    return fired;
+}
+
+// The approach being replaced: append, sort descending, fire from the back
+struct SortPerTick {
+    CustomCXX::Vector<long long> items;
+
+    void push(long long deadline) { items.push_back(deadline); }
+    long long fire_due(long long now) {
+        items.sort(std::greater<long long>());
+        long long fired = 0;
+        while (items.size() > 0 && items[items.size() - 1] <= now) {
+            items.pop_back();
+            ++fired;
+        }
+        return fired;
+    }
+};
+
+long long run_sort_ticks(const std::vector<long long>& delays, size_t ticks, size_t batch) {
+    SortPerTick scheduler;
+    long long fired = 0;
+    size_t next = 0;
+    for (long long now = 0; now < static_cast<long long>(ticks); ++now) {
+        for (size_t i = 0; i < batch; ++i) {
+            scheduler.push(now + delays[next++ % delays.size()]);
+        }
+        fired += scheduler.fire_due(now);
+    }
+    return fired;
+}
+
+// "Hold" model: a queue of fixed size where every pop is followed by a push
+template <typename Queue>
+void run_hold(Queue& queue, const std::vector<long long>& delays, size_t operations) {
+    for (size_t i = 0; i < operations; ++i) {
+        long long next = queue.top() + delays[i % delays.size()];
+        queue.pop();
+        queue.push(next);
+    }
+    sink = queue.top();
+}
+
+template <size_t Arity>
+using MinQueue = CustomCXX::PriorityQueue<long long, std::greater<long long>, Arity>;
+using StdMinQueue = std::priority_queue<long long, std::vector<long long>, std::greater<long long>>;
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t ticks = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+    size_t batch = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 500;
+    long long horizon = argc > 3 ? std::strtoll(argv[3], nullptr, 10) : 200;
+    size_t hold_size = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 1000000;
+
+    std::mt19937_64 rng(1);
+    std::vector<long long> delays(1 << 16);
+    for (auto& delay : delays) {
+        delay = 1 + static_cast<long long>(rng() % horizon);
+    }
+
+    std::printf("Scheduler: %zu ticks x %zu timers, due within %lld ticks (~%lld pending)\n\n",
+                ticks, batch, horizon, static_cast<long long>(batch) * horizon / 2);
+    std::printf("%-30s %12s\n", "", "ms");
+
+    double t;
+    t = time_ms([&]() { sink = run_sort_ticks(delays, ticks, batch); });
+    std::printf("%-30s %12.2f\n", "Vector::sort per tick", t);
+    {
+        StdMinQueue queue;
+        t = time_ms([&]() { sink = run_ticks(queue, delays, ticks, batch); });
+        std::printf("%-30s %12.2f\n", "std::priority_queue", t);
+    }
+    {
+        MinQueue<2> queue;
+        t = time_ms([&]() { sink = run_ticks(queue, delays, ticks, batch); });
+        std::printf("%-30s %12.2f\n", "PriorityQueue, 2-ary", t);
+    }
+    {
+        MinQueue<4> queue;
+        t = time_ms([&]() { sink = run_ticks(queue, delays, ticks, batch); });
+        std::printf("%-30s %12.2f\n", "PriorityQueue, 4-ary", t);
+    }
+    {
+        MinQueue<8> queue;
+        t = time_ms([&]() { sink = run_ticks(queue, delays, ticks, batch); });
+        std::printf("%-30s %12.2f\n", "PriorityQueue, 8-ary", t);
+    }
+
+    // Hold model on a large queue, where cache misses dominate
+    CustomCXX::Vector<long long> initial;
+    for (size_t i = 0; i < hold_size; ++i) {
+        initial.push_back(static_cast<long long>(rng() % (hold_size * 4)));
+    }
+    size_t operations = 4000000;
+    std::printf("\nHold: %zu pop+push pairs on %zu elements\n\n", operations, hold_size);
+    {
+        StdMinQueue queue(std::greater<long long>(), std::vector<long long>(initial.begin(), initial.end()));
+        t = time_ms([&]() { run_hold(queue, delays, operations); });
+        std::printf("%-30s %12.2f\n", "std::priority_queue", t);
+    }
+    {
+        MinQueue<2> queue(initial);
+        t = time_ms([&]() { run_hold(queue, delays, operations); });
+        std::printf("%-30s %12.2f\n", "PriorityQueue, 2-ary", t);
+    }
+    {
+        MinQueue<4> queue(initial);
+        t = time_ms([&]() { run_hold(queue, delays, operations); });
+        std::printf("%-30s %12.2f\n", "PriorityQueue, 4-ary", t);
+    }
+    {
+        MinQueue<8> queue(initial);
+        t = time_ms([&]() { run_hold(queue, delays, operations); });
+        std::printf("%-30s %12.2f\n", "PriorityQueue, 8-ary", t);
+    }
+
+    // Building from existing data
+    std::printf("\nBuilding a queue of %zu elements\n\n", hold_size);
+    t = time_ms([&]() {
+        MinQueue<4> queue(initial);
+        sink = queue.top();
+    });
+    std::printf("%-30s %12.2f\n", "heapify (copying the Vector)", t);
+    t = time_ms([&]() {
+        MinQueue<4> queue;
+        queue.reserve(hold_size);
+        const long long* values = initial.begin();
+        for (size_t i = 0; i < hold_size; ++i) {
+            queue.push(values[i]);
+        }
+        sink = queue.top();
+    });
+    std::printf("%-30s %12.2f\n", "n pushes", t);
+    return 0;
+}
@@ -0,0 +1,155 @@
+// Reader fan-out: handing a copy of shared reference data to every reader
+// thread with deep copies versus copy-on-write snapshots.
+
+#include "Map.h"
+#include "Vector.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::atomic<size_t> allocated_bytes{0};
+
+template <typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+// Bytes allocated while running f
+template <typename F>
+size_t bytes_allocated(F&& f) {
+    size_t before = allocated_bytes.load();
+    f();
+    return allocated_bytes.load() - before;
+}
+
+volatile long long sink;
+
+} // namespace
+
+// Counting allocator hooks, so copies can be measured without external tools
+void* operator new(size_t size) {
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+void operator delete[](void* p, size_t) noexcept {
+    std::free(p);
+}
+
+int main(int argc, char** argv) {
+    size_t readers = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16;
+    size_t elements = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000;
+
+    CustomCXX::Vector<long long> table(elements);
+    for (size_t i = 0; i < elements; ++i) {
+        table[i] = static_cast<long long>(i);
+    }
+    CustomCXX::Map<long long, long long> index;
+    for (size_t i = 0; i < elements / 10; ++i) {
+        index.insert_or_assign(static_cast<long long>(i), static_cast<long long>(i * 3));
+    }
+
+    std::printf("%zu readers, Vector of %zu elements, Map of %zu entries\n\n", readers, elements, elements / 10);
+    std::printf("%-26s %12s %16s\n", "variant", "copy ms", "copied bytes");
+
+    std::vector<CustomCXX::Vector<long long>> vector_copies;
+    std::vector<CustomCXX::Map<long long, long long>> map_copies;
+    vector_copies.reserve(readers);
+    map_copies.reserve(readers);
+
+    double t = 0;
+    size_t bytes = bytes_allocated([&]() {
+        t = time_ms([&]() {
+            for (size_t r = 0; r < readers; ++r) {
+                vector_copies.emplace_back(table);
+            }
+        });
+    });
+    std::printf("%-26s %12.3f %16zu\n", "Vector deep copy", t, bytes);
+    vector_copies.clear();
+
+    bytes = bytes_allocated([&]() {
+        t = time_ms([&]() {
+            for (size_t r = 0; r < readers; ++r) {
+                vector_copies.push_back(table.snapshot());
+            }
+        });
+    });
+    std::printf("%-26s %12.3f %16zu\n", "Vector snapshot", t, bytes);
+
+    bytes = bytes_allocated([&]() {
+        t = time_ms([&]() {
+            for (size_t r = 0; r < readers; ++r) {
+                map_copies.emplace_back(index);
+            }
+        });
+    });
+    std::printf("%-26s %12.3f %16zu\n", "Map deep copy", t, bytes);
+    map_copies.clear();
+
+    bytes = bytes_allocated([&]() {
+        t = time_ms([&]() {
+            for (size_t r = 0; r < readers; ++r) {
+                map_copies.push_back(index.snapshot());
+            }
+        });
+    });
+    std::printf("%-26s %12.3f %16zu\n", "Map snapshot", t, bytes);
+
+    // Readers scan their snapshots concurrently
+    t = time_ms([&]() {
+        std::vector<std::thread> threads;
+        for (size_t r = 0; r < readers; ++r) {
+            threads.emplace_back([&, r]() {
+                const auto& vec = vector_copies[r];
+                const auto& map = map_copies[r];
+                long long acc = 0;
+                for (size_t i = 0; i < vec.size(); i += 64) {
+                    acc += vec[i];
+                }
+                for (long long k = 0; k < 1000; ++k) {
+                    acc += map.at(k);
+                }
+                sink = acc;
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    });
+    std::printf("\n%-26s %12.3f\n", "reader scan (shared)", t);
+
+    // A writer touching one key clones only one bucket group of the Map
+    bytes = bytes_allocated([&]() {
+        t = time_ms([&]() { index.insert_or_assign(42, -1); });
+    });
+    std::printf("%-26s %12.3f %16zu\n", "Map first write", t, bytes);
+    bytes = bytes_allocated([&]() {
+        t = time_ms([&]() { table[0] = -1; });
+    });
+    std::printf("%-26s %12.3f %16zu\n", "Vector first write", t, bytes);
+    return 0;
+}
@@ -0,0 +1,146 @@
+// Inner-loop cost of Vector's access paths: throwing at(), operator[] on a
+// mutable Vector (copy-on-write check per access), operator[] on a const
+// Vector (unchecked in release builds) and a Span taken once per kernel.
+//
+// The const operator[] and Span kernels should auto-vectorize; the mutable
+// operator[] ones do not, since the copy-on-write check may allocate. To
+// confirm, build this target with -fopt-info-vec-optimized (GCC) or
+// -Rpass=loop-vectorize (Clang) and look for the kernels below in the
+// report. A single at() loop bounded by size() may still vectorize once the
+// compiler proves the check dead; the two-container axpy kernel is where
+// that stops happening.
+
+#include "Span.h"
+#include "Vector.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+template <typename F>
+double time_ms(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+volatile int64_t sink;
+
+// Sum kernels: a reduction over int32 values
+
+int64_t sum_at(const CustomCXX::Vector<int32_t>& values) {
+    int64_t total = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        total += values.at(i);
+    }
+    return total;
+}
+
+int64_t sum_mutable_index(CustomCXX::Vector<int32_t>& values) {
+    int64_t total = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        total += values[i];
+    }
+    return total;
+}
+
+int64_t sum_const_index(const CustomCXX::Vector<int32_t>& values) {
+    int64_t total = 0;
+    for (size_t i = 0; i < values.size(); ++i) {
+        total += values[i];
+    }
+    return total;
+}
+
+int64_t sum_view(CustomCXX::View<int32_t> values) {
+    int64_t total = 0;
+    for (int32_t value : values) {
+        total += value;
+    }
+    return total;
+}
+
+// Axpy kernels: y[i] += a * x[i], element-wise over floats
+
+void axpy_at(float a, const CustomCXX::Vector<float>& x, CustomCXX::Vector<float>& y) {
+    for (size_t i = 0; i < y.size(); ++i) {
+        y.at(i) += a * x.at(i);
+    }
+}
+
+void axpy_mutable_index(float a, const CustomCXX::Vector<float>& x, CustomCXX::Vector<float>& y) {
+    for (size_t i = 0; i < y.size(); ++i) {
+        y[i] += a * x[i];
+    }
+}
+
+void axpy_span(float a, CustomCXX::View<float> x, CustomCXX::Span<float> y) {
+    for (size_t i = 0; i < y.size(); ++i) {
+        y[i] += a * x[i];
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1 << 16;
+    size_t rounds = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4000;
+
+    CustomCXX::Vector<int32_t> ints;
+    CustomCXX::Vector<float> x;
+    CustomCXX::Vector<float> y;
+    ints.reserve(size);
+    x.reserve(size);
+    y.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        ints.push_back(static_cast<int32_t>(i * 2654435761u >> 16));
+        x.push_back(static_cast<float>(i % 100) * 0.01f);
+        y.push_back(1.0f);
+    }
+    const CustomCXX::Vector<int32_t>& const_ints = ints;
+
+    std::printf("%zu elements x %zu rounds (CUSTOMCXX_ASSERT_BOUNDS=%d)\n\n", size, rounds, CUSTOMCXX_ASSERT_BOUNDS);
+    std::printf("%-34s %12s %12s\n", "", "ms", "Melem/s");
+
+    auto report = [&](const char* label, double ms) {
+        std::printf("%-34s %12.2f %12.0f\n", label, ms, static_cast<double>(size) * rounds / (ms * 1000.0));
+    };
+
+    double t;
+    t = time_ms([&]() {
+        for (size_t r = 0; r < rounds; ++r) sink = sum_at(const_ints);
+    });
+    report("sum: at()", t);
+    t = time_ms([&]() {
+        for (size_t r = 0; r < rounds; ++r) sink = sum_mutable_index(ints);
+    });
+    report("sum: operator[] (mutable)", t);
+    t = time_ms([&]() {
+        for (size_t r = 0; r < rounds; ++r) sink = sum_const_index(const_ints);
+    });
+    report("sum: operator[] (const)", t);
+    t = time_ms([&]() {
+        for (size_t r = 0; r < rounds; ++r) sink = sum_view(ints.span());
+    });
+    report("sum: View", t);
+
+    std::printf("\n");
+    float a = 0.5f;
+    t = time_ms([&]() {
+        for (size_t r = 0; r < rounds; ++r) axpy_at(a, x, y);
+    });
+    report("axpy: at()", t);
+    t = time_ms([&]() {
+        for (size_t r = 0; r < rounds; ++r) axpy_mutable_index(a, x, y);
+    });
+    report("axpy: operator[] (mutable)", t);
+    t = time_ms([&]() {
+        for (size_t r = 0; r < rounds; ++r) axpy_span(a, x.span(), y.span());
+    });
+    report("axpy: Span", t);
+    sink = static_cast<int64_t>(y.span().back());
+    return 0;
+}
@@ -0,0 +1,127 @@
+#ifndef CUSTOMCXX_BITVECTOR_H
+#define CUSTOMCXX_BITVECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+
+#include "./Vector.h"
+
+namespace CustomCXX {
+
+/**
+ * A dynamic array of bits packed 64 to a machine word.
+ *
+ * Uses 1/8 of the memory of Vector<bool>. Bulk operations work a word at a
+ * time: count() uses hardware popcount, set-bit scans use count-trailing-zeros,
+ * and the bitwise operators process several words per SIMD instruction.
+ * rank()/select() are answered from a block index once build_rank_index()
+ * has been called, and by scanning otherwise; any modification drops the index.
+ * Bits past size() in the last word are always kept at zero.
+ */
+class BitVector {
+private:
+    uint64_t* _words;       // Packed bits, least significant bit first
+    size_t _word_capacity;  // Allocated words
+    size_t _size;           // Number of bits
+    Vector<size_t> _rank;   // Set bits before each block of RANK_BLOCK_WORDS words
+    bool _rank_valid;       // Whether _rank matches the current bits
+
+    static constexpr size_t WORD_BITS = 64;
+    static constexpr size_t RANK_BLOCK_WORDS = 8; // 512 bits per rank block
+
+    static size_t words_for(size_t bits);
+    size_t word_count() const;
+    void reallocate(size_t new_word_capacity);
+    void clear_tail();  // Zeroes the unused bits of the last word
+    void check_same_size(const BitVector& other) const;
+
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1); // "No such bit"
+
+    // Proxy returned by the non-const operator[]
+    class Reference {
+    public:
+        Reference& operator=(bool value);
+        Reference& operator=(const Reference& other);
+        operator bool() const;
+        void flip();
+
+    private:
+        friend class BitVector;
+        Reference(BitVector& owner, size_t index);
+        BitVector* _owner;
+        size_t _index;
+    };
+
+    // Constructors and Destructor
+    BitVector();                                  // Default constructor
+    explicit BitVector(size_t bits, bool value = false); // `bits` bits, all equal to value
+    BitVector(std::initializer_list<bool> list);  // Initializer list constructor
+    BitVector(const BitVector& other);            // Copy constructor
+    BitVector(BitVector&& other) noexcept;        // Move constructor
+    ~BitVector();                                 // Destructor
+
+    // Assignment Operators
+    BitVector& operator=(const BitVector& other);
+    BitVector& operator=(BitVector&& other) noexcept;
+
+    // Element Access
+    Reference operator[](size_t index);   // Proxy reference
+    bool operator[](size_t index) const;
+    bool test(size_t index) const;
+
+    // Single-bit Modifiers
+    void set(size_t index, bool value = true);
+    void reset(size_t index);
+    void flip(size_t index);
+    void push_back(bool value);
+    void pop_back();
+
+    // Whole-vector Modifiers
+    void set();                               // Sets every bit
+    void reset();                             // Clears every bit
+    void flip();                              // Inverts every bit
+    void resize(size_t bits, bool value = false); // Grows with `value` or truncates
+    void clear();                             // Removes all bits
+    void reserve(size_t bits);
+
+    // Bulk Bitwise Operations (sizes must match)
+    BitVector& operator&=(const BitVector& other);
+    BitVector& operator|=(const BitVector& other);
+    BitVector& operator^=(const BitVector& other);
+    BitVector& and_not(const BitVector& other); // this &= ~other
+
+    // Queries
+    size_t size() const;
+    size_t capacity() const;                  // In bits
+    bool empty() const;
+    size_t count() const;                     // Number of set bits
+    bool any() const;
+    bool none() const;
+    bool all() const;
+    size_t find_first() const;                // First set bit, or npos
+    size_t find_next(size_t index) const;     // First set bit after index, or npos
+
+    // Rank / Select
+    void build_rank_index();                  // O(n / 64) index for rank/select
+    size_t rank(size_t index) const;          // Set bits in [0, index)
+    size_t select(size_t k) const;            // Position of the k-th set bit (from 0), or npos
+
+    // Raw word access for custom kernels
+    const uint64_t* words() const;
+
+    // Comparison ops
+    bool operator==(const BitVector& other) const;
+};
+
+BitVector operator&(BitVector lhs, const BitVector& rhs);
+BitVector operator|(BitVector lhs, const BitVector& rhs);
+BitVector operator^(BitVector lhs, const BitVector& rhs);
+
+} // namespace CustomCXX
+
+#include "../src/BitVector.tpp"
+
+#endif // CUSTOMCXX_BITVECTOR_H
@@ -0,0 +1,96 @@
+#ifndef CUSTOMCXX_FIXEDMAP_H
+#define CUSTOMCXX_FIXEDMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility> // For std::pair
+
+#include "./FixedVector.h"
+
+namespace CustomCXX {
+
+/**
+ * Salted constexpr hash used by FixedMap.
+ * Provided for integral types, enums and std::string_view; specialize it
+ * with `constexpr uint64_t operator()(const Key&, uint64_t salt) const`
+ * for other key types. FixedMap takes its slots from the high bits of the
+ * result, so those must depend on every bit of the key and of the salt.
+ */
+template <typename Key, typename Enable = void>
+struct FixedHash;
+
+template <typename Key>
+struct FixedHash<Key, std::enable_if_t<std::is_integral_v<Key> || std::is_enum_v<Key>>> {
+    constexpr uint64_t operator()(Key key, uint64_t salt) const;
+};
+
+template <>
+struct FixedHash<std::string_view> {
+    constexpr uint64_t operator()(std::string_view key, uint64_t salt) const;
+};
+
+namespace detail {
+    // log2 of the slot count of a FixedMap: smallest power of two >= n
+    constexpr unsigned fixed_table_bits(size_t n) {
+        unsigned bits = 0;
+        while ((size_t(1) << bits) < n) {
+            ++bits;
+        }
+        return bits;
+    }
+} // namespace detail
+
+/**
+ * Immutable hash map for at most N entries, built from an initializer list.
+ *
+ * Construction computes a perfect hash: keys are grouped into first-level
+ * buckets, and every bucket is given its own salt under which its keys land
+ * in distinct, still free slots. A lookup is therefore two hashes and a
+ * single key comparison - no probing, no chains, no allocation. Declared
+ * `static constexpr`, the whole table is computed by the compiler and lives
+ * in read-only data.
+ *
+ * Key and Value must be literal, default-constructible types
+ * (e.g. integers, enums, std::string_view, function pointers).
+ */
+template <typename Key, typename Value, size_t N, typename Hash = FixedHash<Key>>
+class FixedMap {
+private:
+    static constexpr unsigned table_bits = detail::fixed_table_bits(N);
+    static constexpr size_t table_size = size_t(1) << table_bits; // Slots (power of two)
+    static constexpr uint32_t max_seed_attempts = 1u << 20;       // Per bucket, before giving up
+
+    Key _keys[table_size]{};
+    Value _values[table_size]{};
+    bool _used[table_size]{};
+    uint64_t _salts[table_size]{}; // Second-level salt for each first-level bucket
+    size_t _size = 0;
+
+    static constexpr size_t index_of(uint64_t hash);  // Top table_bits bits of a hash
+    constexpr size_t bucket_of(const Key& key) const; // First-level bucket
+    constexpr size_t slot_of(const Key& key) const;   // Final slot
+
+public:
+    constexpr FixedMap() = default;
+    constexpr FixedMap(std::initializer_list<std::pair<Key, Value>> list); // Builds the perfect hash
+
+    constexpr const Value* find(const Key& key) const;  // Pointer to the value, or nullptr
+    constexpr bool contains(const Key& key) const;      // Check if a key exists
+    constexpr const Value& at(const Key& key) const;    // Access an existing key
+    constexpr Value value_or(const Key& key, const Value& fallback) const;
+
+    constexpr size_t size() const;                      // Return number of entries
+    constexpr bool empty() const;                       // Check if map is empty
+    static constexpr size_t capacity();                 // Returns N
+    constexpr FixedVector<Key, N> keys() const;         // All keys, in slot order
+};
+
+} // namespace CustomCXX
+
+#include "../src/FixedMap.tpp"
+
+#endif // CUSTOMCXX_FIXEDMAP_H
@@ -0,0 +1,69 @@
+#ifndef CUSTOMCXX_FIXEDVECTOR_H
+#define CUSTOMCXX_FIXEDVECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility> // For std::move
+
+#include "./Span.h"
+
+namespace CustomCXX {
+
+/**
+ * A Vector with inline storage for at most N elements.
+ * Never allocates, and every member is constexpr, so a FixedVector can be
+ * built at compile time and stored as a `static constexpr` table.
+ * T must be default-constructible; unused slots hold T{}.
+ */
+template <typename T, size_t N>
+class FixedVector {
+private:
+    T _data[N > 0 ? N : 1]{}; // Inline storage (one dummy slot when N == 0)
+    size_t _size = 0;         // Current number of elements
+
+public:
+    // Constructors
+    constexpr FixedVector() = default;
+    constexpr FixedVector(std::initializer_list<T> list); // Initializer list constructor
+
+    // Element Access (operator[] is checked only per CUSTOMCXX_ASSERT_BOUNDS)
+    constexpr T& operator[](size_t index);             // Non-const subscript operator
+    constexpr const T& operator[](size_t index) const; // Const subscript operator
+    constexpr T& at(size_t index);                     // Bounds-checked, throws std::out_of_range
+    constexpr const T& at(size_t index) const;
+    constexpr Span<T> span();                          // Zero-copy view
+    constexpr Span<const T> span() const;
+    constexpr T& front();
+    constexpr const T& front() const;
+    constexpr T& back();
+    constexpr const T& back() const;
+
+    // Modifiers
+    constexpr void push_back(const T& value);          // Adds an element to the end
+    constexpr void pop_back();                         // Removes the last element
+    constexpr void clear();                            // Removes all elements
+    constexpr void insert(size_t index, const T& value); // Inserts an element
+    constexpr void erase(size_t index);                // Removes an element at a given index
+
+    // Capacity
+    constexpr size_t size() const;      // Returns the number of elements
+    constexpr bool empty() const;       // Checks whether the vector is empty
+    static constexpr size_t capacity(); // Returns N
+    constexpr bool full() const;        // Checks whether size() == N
+
+    // Iterators
+    constexpr T* begin();
+    constexpr T* end();
+    constexpr const T* begin() const;
+    constexpr const T* end() const;
+
+    // Comparison ops
+    constexpr bool operator==(const FixedVector& other) const;
+};
+
+} // namespace CustomCXX
+
+#include "../src/FixedVector.tpp"
+
+#endif // CUSTOMCXX_FIXEDVECTOR_H
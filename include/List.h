@@ -1,7 +1,10 @@
 #ifndef CUSTOMCXX_LIST_H
 #define CUSTOMCXX_LIST_H
 
+#include <functional>
+#include <initializer_list>
 #include <stdexcept>
+#include <utility>
 
 namespace CustomCXX {
 
@@ -26,14 +29,21 @@ private:
     Node* merge(Node* left, Node* right, Compare comp); // Merge two sorted lists
 
     Node* find_middle(Node* node); // Helper to find the middle of the list
+    void unlink(Node* node);       // Detach a node, keeping head and tail valid
 
 
 public:
     // Constructors and Destructor
     List();
     List(std::initializer_list<T> list); // Initializer list constructor
+    List(const List& other);             // Copy constructor
+    List(List&& other) noexcept;         // Move constructor
     ~List();
 
+    // Assignment Operators
+    List& operator=(const List& other);
+    List& operator=(List&& other) noexcept;
+
     // Sorting
     void sort(); // Default ascending sort
     template <typename Compare>
@@ -48,6 +58,8 @@ public:
     void insert(size_t index, const T& value); // Insert at a specific position
     void erase(size_t index); // Remove at a specific position
     void reverse(); // Reverse the list
+    void erase_node(Node* node);    // O(1) removal of a node obtained from begin()/rbegin()
+    void move_to_front(Node* node); // O(1) relink of a node to the front
 
     // Access
     T& front();
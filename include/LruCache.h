@@ -0,0 +1,184 @@
+#ifndef CUSTOMCXX_LRUCACHE_H
+#define CUSTOMCXX_LRUCACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace CustomCXX {
+
+/**
+ * Replacement policy of an LruCache.
+ *  - LRU:   every hit moves the entry to the front; the back is evicted.
+ *  - Clock: a hit only sets the entry's reference bit; eviction sweeps a
+ *           hand over the entries, giving referenced ones a second chance.
+ *           Hits never relink nodes, which suits read-mostly workloads and
+ *           lets ShardedLruCache serve them under a shared lock.
+ */
+enum class EvictionPolicy { LRU, Clock };
+
+template <typename Key, typename Value, typename Hash>
+class ShardedLruCache;
+
+/**
+ * Bounded key-value cache with O(1) get, put, touch and erase.
+ *
+ * Entries are intrusive nodes: the key, the value, the hash chain link and
+ * the recency links live in a single allocation per entry. The bound is
+ * either an entry count, or a total weight (e.g. bytes) computed by a
+ * user-supplied weigher. An optional callback sees every entry evicted to
+ * stay within the bound; erase(), clear() and overwrites do not invoke it.
+ *
+ * Pointers returned by get()/peek() stay valid until the entry is erased,
+ * overwritten or evicted. Not thread-safe; see ShardedLruCache.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache {
+public:
+    using Weigher = std::function<size_t(const Key&, const Value&)>;
+    using EvictionCallback = std::function<void(const Key&, Value&)>; // May move the value out
+
+private:
+    struct Node {
+        Key key;
+        Value value;
+        size_t hash;                     // Mixed hash of key
+        size_t weight;                   // 1, or the weigher's result
+        Node* chain;                     // Next node in the same bucket
+        Node* prev;                      // Towards the front
+        Node* next;                      // Towards the back
+        std::atomic<bool> referenced{false}; // Clock reference bit; may be set under a shared lock
+
+        template <typename V>
+        Node(const Key& key, V&& value, size_t hash, size_t weight);
+    };
+
+    Node** _buckets;          // Hash chains, power-of-two count
+    size_t _bucket_count;
+    unsigned _bucket_shift;   // 64 - log2(_bucket_count): buckets use the top hash bits
+    Node* _head;              // Front: most recently used (LRU)
+    Node* _tail;              // Back: next victim (LRU)
+    Node* _hand;              // Clock hand: next node to examine (Clock)
+    size_t _size;
+    size_t _weight;           // Sum of the weights of all entries
+    size_t _max_weight;       // capacity() or the byte budget
+    EvictionPolicy _policy;
+    Weigher _weigher;         // Empty: every entry weighs 1
+    EvictionCallback _on_evict;
+
+    static constexpr size_t INITIAL_BUCKETS = 16;
+
+    static size_t mix(size_t hash);   // Spreads std::hash output over all bits
+    size_t bucket_of(size_t hash) const;
+    Node* find_node(const Key& key, size_t hash) const;
+    void mark_used(Node* node);       // LRU: move to front; Clock: set reference bit
+    void link(Node* node);            // Adds to the recency list per policy
+    void unlink(Node* node);          // Removes from the recency list
+    void chain_insert(Node* node);
+    void chain_remove(Node* node);
+    void grow();                      // Doubles the bucket count
+    void evict_one(const Node* keep); // Never evicts keep
+    void destroy_all();
+
+    template <typename V>
+    bool put_impl(const Key& key, size_t hash, V&& value);
+
+    friend class ShardedLruCache<Key, Value, Hash>;
+
+public:
+    // Constructors and Destructor
+    explicit LruCache(size_t capacity, EvictionPolicy policy = EvictionPolicy::LRU); // At most capacity entries
+    LruCache(size_t max_weight, Weigher weigher, EvictionPolicy policy = EvictionPolicy::LRU); // Weight-bounded
+    LruCache(const LruCache& other) = delete;
+    LruCache(LruCache&& other) noexcept;
+    ~LruCache();
+
+    // Assignment Operators
+    LruCache& operator=(const LruCache& other) = delete;
+    LruCache& operator=(LruCache&& other) noexcept;
+
+    // Lookup
+    Value* get(const Key& key);                 // Marks the entry used; nullptr on a miss
+    const Value* peek(const Key& key) const;    // Does not affect eviction order
+    bool contains(const Key& key) const;
+    bool touch(const Key& key);                 // Marks the entry used; false on a miss
+
+    // Modifiers
+    bool put(const Key& key, const Value& value); // Insert or assign, then evict to fit
+    bool put(const Key& key, Value&& value);
+    bool erase(const Key& key);                 // False if the key was absent
+    void clear();
+    void set_eviction_callback(EvictionCallback callback);
+
+    // Utilities
+    size_t size() const;
+    bool empty() const;
+    size_t capacity() const;                    // Entry or weight bound
+    size_t weight() const;                      // Current total weight
+    EvictionPolicy policy() const;
+};
+
+/**
+ * Thread-safe LruCache split into independently locked shards.
+ *
+ * A key's shard is picked from its hash, and the bound is divided evenly
+ * between shards, so eviction is per shard. Under the Clock policy get() and
+ * contains() take only a shared lock; under LRU a hit relinks the entry and
+ * needs the shard exclusively. Lookups return copies, since a pointer into a
+ * shard would not survive its lock. The eviction callback runs with the
+ * shard's lock held and must not call back into the cache.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ShardedLruCache {
+private:
+    using Cache = LruCache<Key, Value, Hash>;
+
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        Cache cache;
+
+        template <typename... Args>
+        explicit Shard(Args&&... args);
+    };
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    EvictionPolicy _policy;
+
+    static constexpr size_t DEFAULT_SHARDS = 16;
+
+    Shard& shard_for(size_t hash) const;
+    static size_t per_shard(size_t bound, size_t shard_count);
+
+public:
+    explicit ShardedLruCache(size_t capacity, size_t shard_count = DEFAULT_SHARDS,
+                             EvictionPolicy policy = EvictionPolicy::LRU);
+    ShardedLruCache(size_t max_weight, typename Cache::Weigher weigher, size_t shard_count = DEFAULT_SHARDS,
+                    EvictionPolicy policy = EvictionPolicy::LRU);
+
+    std::optional<Value> get(const Key& key);   // Copy of the value, marked used
+    bool contains(const Key& key) const;        // Does not affect eviction order
+    bool touch(const Key& key);                 // Marks the entry used without copying it
+    bool put(const Key& key, const Value& value);
+    bool put(const Key& key, Value&& value);
+    bool erase(const Key& key);
+    void clear();
+    void set_eviction_callback(typename Cache::EvictionCallback callback);
+
+    size_t size() const;                        // Sum over shards; approximate under concurrent writes
+    size_t capacity() const;
+    size_t shard_count() const;
+};
+
+} // namespace CustomCXX
+
+#include "../src/LruCache.tpp"
+
+#endif // CUSTOMCXX_LRUCACHE_H
@@ -1,8 +1,11 @@
 #ifndef CUSTOMCXX_MAP_H
 #define CUSTOMCXX_MAP_H
 
+#include <algorithm> // For std::min
+#include <atomic>
 #include <vector>
 #include <list>
+#include <memory>
 #include <utility> // For std::pair
 #include <cstddef>
 #include <stdexcept>
@@ -19,19 +22,46 @@ private:
         Value value;
     };
 
-    std::vector<std::list<Node>> buckets; // Hash table buckets
+    // Buckets are stored in groups of up to BUCKETS_PER_GROUP behind
+    // reference-counted pointers, so a snapshot shares them and a write clones
+    // only the table of group pointers plus the one group it touches. The
+    // last group holds only the buckets it needs, so small Maps stay small.
+    static constexpr size_t BUCKETS_PER_GROUP = 64;
+    struct BucketGroup {
+        std::vector<std::list<Node>> buckets;
+    };
+    using GroupTable = std::vector<std::shared_ptr<BucketGroup>>;
+
+    std::shared_ptr<GroupTable> groups;   // Hash table buckets, in groups; null once moved from
     size_t bucket_count;                  // Total number of buckets
     size_t size_;                         // Number of key-value pairs
 
     size_t hash(const Key& key) const;    // Hash function
+    const std::list<Node>& bucket(size_t index) const; // Read-only bucket
+    std::list<Node>& mutable_bucket(size_t index);     // Writable bucket (clones shared groups)
+
+    static std::shared_ptr<GroupTable> make_table(size_t bucket_count); // Empty groups
+    static std::shared_ptr<GroupTable> clone_table(const GroupTable& table); // Deep copy
+    static const std::list<Node>& empty_bucket(); // Read by Maps that have no table
+
+    Map(std::shared_ptr<GroupTable> groups, size_t bucket_count, size_t size); // Used by snapshot()
 
     static constexpr double LOAD_FACTOR_THRESHOLD = 0.75; // Load factor threshold for rehashing
 
 public:
     Map(size_t bucket_count = 16);        // Constructor with bucket count
+    Map(const Map& other);                // Deep copy
+    Map(Map&& other) noexcept;            // Move constructor
     ~Map() = default;
 
+    Map& operator=(const Map& other);     // Deep copy assignment
+    Map& operator=(Map&& other) noexcept; // Move assignment
+
+    Map snapshot() const;                 // O(1) copy-on-write copy sharing all buckets
+    bool is_shared() const;               // True while any bucket group is shared
+
     Value& operator[](const Key& key);    // Access or insert a key
+    const Value& at(const Key& key) const; // Access an existing key without copying shared buckets
     bool contains(const Key& key) const; // Check if a key exists
     void erase(const Key& key);          // Remove a key-value pair
     size_t size() const;                 // Return number of elements
@@ -0,0 +1,41 @@
+#ifndef CUSTOMCXX_PARALLEL_H
+#define CUSTOMCXX_PARALLEL_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "./ThreadPool.h"
+#include "./Vector.h"
+
+namespace CustomCXX {
+
+// Data-parallel algorithms over Vector. Each has an overload taking an explicit
+// ThreadPool and one that uses ThreadPool::instance(). A `grain` of 0 picks the
+// chunk size from the input size and the pool's concurrency; the calling thread
+// always works on chunks alongside the pool.
+
+template <typename T, typename F>
+void parallel_for_each(ThreadPool& pool, Vector<T>& vec, F f, size_t grain = 0);   // f(T&) on every element
+template <typename T, typename F>
+void parallel_for_each(Vector<T>& vec, F f, size_t grain = 0);
+
+template <typename T, typename F, typename R = std::decay_t<std::invoke_result_t<F&, const T&>>>
+Vector<R> parallel_transform(ThreadPool& pool, const Vector<T>& input, F f, size_t grain = 0); // New Vector of f(x)
+template <typename T, typename F, typename R = std::decay_t<std::invoke_result_t<F&, const T&>>>
+Vector<R> parallel_transform(const Vector<T>& input, F f, size_t grain = 0);
+
+template <typename T, typename BinaryOp>
+T parallel_reduce(ThreadPool& pool, const Vector<T>& input, T init, BinaryOp op, size_t grain = 0); // op must be associative
+template <typename T, typename BinaryOp>
+T parallel_reduce(const Vector<T>& input, T init, BinaryOp op, size_t grain = 0);
+
+template <typename T, typename Predicate>
+Vector<T> parallel_filter(ThreadPool& pool, const Vector<T>& input, Predicate pred, size_t grain = 0); // Stable compaction
+template <typename T, typename Predicate>
+Vector<T> parallel_filter(const Vector<T>& input, Predicate pred, size_t grain = 0);
+
+} // namespace CustomCXX
+
+#include "../src/Parallel.tpp"
+
+#endif // CUSTOMCXX_PARALLEL_H
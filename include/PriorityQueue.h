@@ -0,0 +1,135 @@
+#ifndef CUSTOMCXX_PRIORITYQUEUE_H
+#define CUSTOMCXX_PRIORITYQUEUE_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "./Vector.h"
+
+namespace CustomCXX {
+
+/**
+ * Priority queue stored as an implicit d-ary heap in a Vector.
+ *
+ * As with std::priority_queue, top() is the element that compares greatest
+ * under Compare; use std::greater<T> for a min-queue (e.g. next-due timers).
+ * Node i's children are Arity * i + 1 .. Arity * i + Arity. With the default
+ * of 4, the heap is half as deep as a binary heap, and the children compared
+ * at each step of a pop sit side by side, usually in one cache line.
+ */
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class PriorityQueue {
+    static_assert(Arity >= 2, "PriorityQueue needs an arity of at least 2");
+
+private:
+    Vector<T> _heap;
+    Compare _comp;
+
+    void sift_up(T* data, size_t index);   // Moves the element at index towards the root
+    void sift_down(T* data, size_t index); // Moves the element at index towards the leaves
+    template <size_t N>
+    size_t best_child(const T* children) const; // Offset of the greatest of N children
+    void heapify();                        // O(n) bottom-up construction
+
+public:
+    // Constructors
+    PriorityQueue();
+    explicit PriorityQueue(const Compare& comp);
+    explicit PriorityQueue(Vector<T> values, const Compare& comp = Compare()); // O(n) heapify
+    PriorityQueue(std::initializer_list<T> list);
+
+    // Element Access
+    const T& top() const;
+
+    // Modifiers
+    void push(const T& value);
+    void push(T&& value);
+    template <typename... Args>
+    void emplace(Args&&... args);
+    void pop();
+    T pop_top();              // Removes and returns the top element, moved out
+    void clear();
+    void reserve(size_t new_capacity);
+
+    // Utilities
+    size_t size() const;
+    bool empty() const;
+};
+
+/**
+ * PriorityQueue whose entries can be re-prioritized or removed after insertion.
+ *
+ * push() returns a Handle that stays bound to its entry until the entry is
+ * popped or erased. Each heap slot records its id and an id table records
+ * each slot, so decrease_key(), update() and erase() find their entry in
+ * O(1) and then restore the heap in O(log n) - e.g. rescheduling or
+ * cancelling timers. Ids are reused, but a Handle also carries its id's
+ * generation (the high half of its bits), so a stale handle - say, a timer
+ * that already fired - is rejected rather than aliasing a newer entry.
+ * A generation wraps only after 2^32 reuses of one id (2^16 with a 32-bit
+ * size_t).
+ */
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class IndexedPriorityQueue {
+    static_assert(Arity >= 2, "IndexedPriorityQueue needs an arity of at least 2");
+
+public:
+    using Handle = size_t;
+
+private:
+    struct Entry {
+        T value;
+        size_t id;          // Index into _slot and _generation
+    };
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    static constexpr unsigned ID_BITS = sizeof(Handle) * 4; // Low half: id; high half: generation
+    static constexpr size_t ID_MASK = (static_cast<size_t>(1) << ID_BITS) - 1;
+
+    Vector<Entry> _heap;
+    Vector<size_t> _slot;       // Heap index of each id, or npos while the id is free
+    Vector<size_t> _generation; // Bumped each time an id is freed, below 2^ID_BITS
+    Vector<size_t> _free;       // Ids available for reuse
+    Compare _comp;
+
+    // The sifts take raw storage, fetched once per operation
+    void sift_up(Entry* data, size_t* slots, size_t index);
+    void sift_down(Entry* data, size_t* slots, size_t index);
+    void remove_at(size_t index);
+    void free_id(size_t id);               // Invalidates the id's handles and queues it for reuse
+    Handle handle_of(size_t id) const;     // Current handle for a live id
+    size_t slot_of(Handle handle) const;   // Heap index of a live handle
+
+public:
+    // Constructors
+    IndexedPriorityQueue();
+    explicit IndexedPriorityQueue(const Compare& comp);
+
+    // Element Access
+    const T& top() const;
+    Handle top_handle() const;
+    const T& get(Handle handle) const;
+    bool contains(Handle handle) const;    // Whether handle refers to a queued entry
+
+    // Modifiers
+    Handle push(const T& value);
+    Handle push(T&& value);
+    void pop();
+    void decrease_key(Handle handle, const T& value); // Raises the entry's priority
+    void update(Handle handle, const T& value);       // Changes the entry's priority either way
+    void erase(Handle handle);
+    void clear();
+
+    // Utilities
+    size_t size() const;
+    bool empty() const;
+};
+
+} // namespace CustomCXX
+
+#include "../src/PriorityQueue.tpp"
+
+#endif // CUSTOMCXX_PRIORITYQUEUE_H
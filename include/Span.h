@@ -0,0 +1,102 @@
+#ifndef CUSTOMCXX_SPAN_H
+#define CUSTOMCXX_SPAN_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * Bounds checking of operator[] on Vector, FixedVector and Span.
+ *  1: an out-of-range index aborts with a message (debug-assert mode).
+ *  0: operator[] is unchecked, leaving hot loops free to vectorize.
+ * Defaults to 1 unless NDEBUG is defined; define it on the command line to
+ * override (e.g. -DCUSTOMCXX_ASSERT_BOUNDS=1 for a hardened release build).
+ * at() always checks and throws std::out_of_range.
+ */
+#ifndef CUSTOMCXX_ASSERT_BOUNDS
+#ifdef NDEBUG
+#define CUSTOMCXX_ASSERT_BOUNDS 0
+#else
+#define CUSTOMCXX_ASSERT_BOUNDS 1
+#endif
+#endif
+
+namespace CustomCXX {
+
+namespace detail {
+    [[noreturn]] inline void bounds_failure(size_t index, size_t size); // Reports and aborts
+
+    // Applies the CUSTOMCXX_ASSERT_BOUNDS policy to an operator[] index
+    constexpr void assert_index(size_t index, size_t size) {
+#if CUSTOMCXX_ASSERT_BOUNDS
+        if (index >= size) {
+            bounds_failure(index, size);
+        }
+#else
+        (void)index;
+        (void)size;
+#endif
+    }
+} // namespace detail
+
+/**
+ * Non-owning view of a contiguous run of elements: a pointer and a size.
+ *
+ * Vector and FixedVector hand out spans so kernels can take a slice without
+ * copying, and loop over it without a copy-on-write check or an exception
+ * path per element. Span<const T> (alias View<T>) is the read-only form;
+ * a Span<T> converts to it implicitly. A span is invalidated by anything
+ * that reallocates or detaches the container it came from.
+ */
+template <typename T>
+class Span {
+private:
+    T* _data;
+    size_t _size;
+
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using iterator = T*;
+    using reverse_iterator = std::reverse_iterator<T*>;
+
+    static constexpr size_t npos = static_cast<size_t>(-1); // "To the end" for subspan()
+
+    // Constructors
+    constexpr Span() noexcept;
+    constexpr Span(T* data, size_t size) noexcept;
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr Span(const Span<U>& other) noexcept; // Span<T> -> Span<const T>
+
+    // Element Access
+    constexpr T& operator[](size_t index) const; // Checked per CUSTOMCXX_ASSERT_BOUNDS
+    constexpr T& at(size_t index) const;         // Always checked
+    constexpr T& front() const;
+    constexpr T& back() const;
+    constexpr T* data() const noexcept;
+
+    // Slicing
+    constexpr Span first(size_t count) const;
+    constexpr Span last(size_t count) const;
+    constexpr Span subspan(size_t offset, size_t count = npos) const;
+
+    // Capacity
+    constexpr size_t size() const noexcept;
+    constexpr bool empty() const noexcept;
+
+    // Iterators
+    constexpr T* begin() const noexcept;
+    constexpr T* end() const noexcept;
+    constexpr reverse_iterator rbegin() const noexcept;
+    constexpr reverse_iterator rend() const noexcept;
+};
+
+template <typename T>
+using View = Span<const T>; // Read-only span
+
+} // namespace CustomCXX
+
+#include "../src/Span.tpp"
+
+#endif // CUSTOMCXX_SPAN_H
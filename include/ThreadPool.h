@@ -0,0 +1,94 @@
+#ifndef CUSTOMCXX_THREADPOOL_H
+#define CUSTOMCXX_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CustomCXX {
+
+/**
+ * A small work-stealing task scheduler.
+ *
+ * Every worker owns a deque: it pushes and pops its own tasks at the back
+ * (LIFO, cache-warm) and idle workers steal from the front of other deques
+ * (FIFO, the largest outstanding pieces of a recursive split). Threads that
+ * are not workers - typically the caller of a parallel algorithm - join in
+ * by running tasks from inside TaskGroup::wait().
+ */
+class ThreadPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit ThreadPool(size_t worker_count = default_worker_count());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void submit(Task task);   // Queues a task (own deque for workers, round-robin otherwise)
+    bool try_run_one();       // Runs one queued task on the calling thread, if any
+
+    size_t worker_count() const; // Number of background threads
+    size_t concurrency() const;  // Workers plus the participating caller
+
+    static size_t default_worker_count(); // hardware_concurrency() - 1
+    static ThreadPool& instance();        // Process-wide default pool
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> _queues; // One deque per worker
+    std::vector<std::thread> _workers;
+    std::atomic<size_t> _queued;      // Tasks sitting in any deque
+    std::atomic<size_t> _next_queue;  // Round-robin cursor for external submits
+    std::atomic<bool> _stop;
+    std::mutex _sleep_mutex;
+    std::condition_variable _wake;
+
+    void worker_loop(size_t index);
+    bool pop_local(size_t index, Task& task);
+    bool steal(size_t thief, Task& task);
+    long current_worker() const; // Index of the calling worker, or -1
+};
+
+/**
+ * Fork-join helper: tracks a set of tasks submitted to a ThreadPool.
+ * wait() runs queued tasks on the calling thread until every task of the
+ * group has finished, then rethrows the first exception any of them threw.
+ */
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& pool);
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    template <typename F>
+    void run(F&& f); // Submits f as part of this group
+
+    void wait();     // Helps execute tasks until the group is done
+
+private:
+    ThreadPool& _pool;
+    std::atomic<size_t> _pending;
+    std::mutex _error_mutex;
+    std::exception_ptr _error;
+};
+
+} // namespace CustomCXX
+
+#include "../src/ThreadPool.tpp"
+
+#endif // CUSTOMCXX_THREADPOOL_H
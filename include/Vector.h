@@ -1,20 +1,31 @@
 #ifndef CUSTOMCXX_VECTOR_H
 #define CUSTOMCXX_VECTOR_H
 
+#include <atomic>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
 #include <utility> // For std::move
 
+#include "./Span.h"
+
 namespace CustomCXX { // Open namespace
 
 template <typename T>
 class Vector {
 private:
+    using RefCount = std::atomic<size_t>;
+
     T* _data;            // Pointer to dynamically allocated memory
     size_t _capacity;    // Total capacity of the vector
     size_t _size;        // Current number of elements in the vector
+    RefCount* _refs;     // Owners of _data once shared by snapshot(); nullptr while unique
 
     void resize(size_t new_capacity); // Resizes the internal storage
+    void detach();                    // Gives this Vector its own storage before a write
+    void detach_shared();             // Slow path of detach() once storage has been shared
+    void release();                   // Drops this Vector's reference to its storage
 
     template <typename Compare>
     void merge(size_t left, size_t mid, size_t right, Compare comp);
@@ -24,6 +35,9 @@ private:
 
 
 public:
+    using reverse_iterator = std::reverse_iterator<T*>;
+    using const_reverse_iterator = std::reverse_iterator<const T*>;
+
     // Constructors and Destructor
     Vector();                              // Default constructor
     explicit Vector(size_t initial_size);  // Constructor with initial size
@@ -32,6 +46,10 @@ public:
     Vector(Vector&& other) noexcept;       // Move constructor
     ~Vector();                             // Destructor
 
+    // Copy-on-write snapshots
+    Vector snapshot();       // O(1) copy sharing this Vector's storage until either side writes
+    bool is_shared() const;  // True while the storage is shared with a snapshot
+
     // Sorting
     void sort(); // Default ascending sort
     template <typename Compare>
@@ -41,12 +59,19 @@ public:
     Vector& operator=(const Vector& other); // Copy assignment operator
     Vector& operator=(Vector&& other) noexcept; // Move assignment operator
 
-    // Element Access
+    // Element Access (operator[] is checked only per CUSTOMCXX_ASSERT_BOUNDS)
     T& operator[](size_t index);             // Non-const subscript operator
     const T& operator[](size_t index) const; // Const subscript operator
+    T& at(size_t index);                     // Bounds-checked, throws std::out_of_range
+    const T& at(size_t index) const;
+    Span<T> span();                          // Zero-copy view for kernels
+    Span<const T> span() const;
 
     // Modifiers
     void push_back(const T& value); // Adds an element to the end
+    void push_back(T&& value);      // Moves an element to the end
+    template <typename... Args>
+    T& emplace_back(Args&&... args); // Constructs an element at the end
     void pop_back();                // Removes the last element
     void clear(); // Removes all elements
     void insert(size_t index, const T& value); // Inserts an element 
@@ -61,8 +86,14 @@ public:
     // Iterators
     T* begin();  // Returns pointer to the first element
     T* end();    // Returns pointer to one past the last element
-    T* rbegin(); // Returns pointer to the last element
-    T* rend();   // Returns pointer to one before the first element
+    const T* begin() const; // Read-only; never copies shared storage
+    const T* end() const;
+    const T* cbegin() const;
+    const T* cend() const;
+    reverse_iterator rbegin(); // Starts at the last element
+    reverse_iterator rend();   // Past the first element
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator rend() const;
 
 
     // Comparison ops
@@ -0,0 +1,677 @@
+#include "../include/BitVector.h"
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(__BMI2__)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace CustomCXX {
+
+    namespace detail {
+        /**
+         * @brief Counts set bits; a single POPCNT instruction when the target has it.
+         */
+        inline unsigned popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_popcountll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+            return static_cast<unsigned>(__popcnt64(x));
+#else
+            x = x - ((x >> 1) & 0x5555555555555555ULL);
+            x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+            x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+            return static_cast<unsigned>((x * 0x0101010101010101ULL) >> 56);
+#endif
+        }
+
+        /**
+         * @brief Index of the lowest set bit. x must not be zero.
+         */
+        inline unsigned ctz64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+            unsigned long index;
+            _BitScanForward64(&index, x);
+            return static_cast<unsigned>(index);
+#else
+            unsigned n = 0;
+            while (!(x & 1)) {
+                x >>= 1;
+                ++n;
+            }
+            return n;
+#endif
+        }
+
+        /**
+         * @brief Position of the k-th set bit (from 0) inside a word holding more than k set bits.
+         */
+        inline unsigned select64(uint64_t x, unsigned k) {
+#if defined(__BMI2__)
+            return ctz64(_pdep_u64(uint64_t(1) << k, x)); // Deposit a single bit onto the k-th set bit
+#else
+            for (unsigned i = 0; i < k; ++i) {
+                x &= x - 1; // Drop the lowest set bit
+            }
+            return ctz64(x);
+#endif
+        }
+
+        enum class BitOp { And, Or, Xor, AndNot };
+
+        /**
+         * @brief dst[i] = dst[i] OP src[i] for n words, 256 or 128 bits at a time when available.
+         */
+        template <BitOp Op>
+        void apply_words(uint64_t* dst, const uint64_t* src, size_t n) {
+            size_t i = 0;
+#if defined(__AVX2__)
+            for (; i + 4 <= n; i += 4) {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+                __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                __m256i r;
+                if constexpr (Op == BitOp::And) r = _mm256_and_si256(a, b);
+                else if constexpr (Op == BitOp::Or) r = _mm256_or_si256(a, b);
+                else if constexpr (Op == BitOp::Xor) r = _mm256_xor_si256(a, b);
+                else r = _mm256_andnot_si256(b, a); // ~b & a
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), r);
+            }
+#elif defined(__SSE2__)
+            for (; i + 2 <= n; i += 2) {
+                __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+                __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                __m128i r;
+                if constexpr (Op == BitOp::And) r = _mm_and_si128(a, b);
+                else if constexpr (Op == BitOp::Or) r = _mm_or_si128(a, b);
+                else if constexpr (Op == BitOp::Xor) r = _mm_xor_si128(a, b);
+                else r = _mm_andnot_si128(b, a); // ~b & a
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), r);
+            }
+#endif
+            for (; i < n; ++i) {
+                if constexpr (Op == BitOp::And) dst[i] &= src[i];
+                else if constexpr (Op == BitOp::Or) dst[i] |= src[i];
+                else if constexpr (Op == BitOp::Xor) dst[i] ^= src[i];
+                else dst[i] &= ~src[i];
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @brief Number of 64-bit words needed to hold `bits` bits.
+     */
+    inline size_t BitVector::words_for(size_t bits) {
+        return (bits + WORD_BITS - 1) / WORD_BITS;
+    }
+
+    inline size_t BitVector::word_count() const {
+        return words_for(_size);
+    }
+
+    /**
+     * @brief Moves the bits into a zero-initialized buffer of a new size.
+     * @param new_word_capacity Number of words to allocate; must hold all current bits.
+     */
+    inline void BitVector::reallocate(size_t new_word_capacity) {
+        uint64_t* new_words = new_word_capacity ? new uint64_t[new_word_capacity]() : nullptr;
+        size_t used = word_count();
+        for (size_t i = 0; i < used; ++i) {
+            new_words[i] = _words[i];
+        }
+        delete[] _words;
+        _words = new_words;
+        _word_capacity = new_word_capacity;
+    }
+
+    /**
+     * @brief Zeroes the bits of the last word that lie past size().
+     */
+    inline void BitVector::clear_tail() {
+        size_t used_bits = _size % WORD_BITS;
+        if (used_bits != 0) {
+            _words[_size / WORD_BITS] &= (uint64_t(1) << used_bits) - 1;
+        }
+    }
+
+    /**
+     * @throws std::invalid_argument If the two BitVectors have different sizes.
+     */
+    inline void BitVector::check_same_size(const BitVector& other) const {
+        if (_size != other._size) {
+            throw std::invalid_argument("BitVector sizes differ");
+        }
+    }
+
+    /**
+     * @brief Default constructor. Allocates nothing.
+     */
+    inline BitVector::BitVector()
+        : _words(nullptr), _word_capacity(0), _size(0), _rank_valid(false) {}
+
+    /**
+     * @brief Constructs a BitVector of `bits` bits, all set to `value`.
+     */
+    inline BitVector::BitVector(size_t bits, bool value)
+        : _words(bits ? new uint64_t[words_for(bits)]() : nullptr), _word_capacity(words_for(bits)),
+          _size(bits), _rank_valid(false) {
+        if (value) {
+            set();
+        }
+    }
+
+    /**
+     * @brief Constructs a BitVector from an initializer list.
+     */
+    inline BitVector::BitVector(std::initializer_list<bool> list) : BitVector(list.size()) {
+        size_t i = 0;
+        for (bool value : list) {
+            if (value) {
+                _words[i / WORD_BITS] |= uint64_t(1) << (i % WORD_BITS);
+            }
+            ++i;
+        }
+    }
+
+    /**
+     * @brief Copy constructor. Creates a deep copy of another BitVector.
+     */
+    inline BitVector::BitVector(const BitVector& other)
+        : _words(other._word_capacity ? new uint64_t[other._word_capacity]() : nullptr),
+          _word_capacity(other._word_capacity), _size(other._size), _rank(other._rank),
+          _rank_valid(other._rank_valid) {
+        size_t used = word_count();
+        for (size_t i = 0; i < used; ++i) {
+            _words[i] = other._words[i];
+        }
+    }
+
+    /**
+     * @brief Move constructor. The source is left empty.
+     */
+    inline BitVector::BitVector(BitVector&& other) noexcept
+        : _words(other._words), _word_capacity(other._word_capacity), _size(other._size),
+          _rank(std::move(other._rank)), _rank_valid(other._rank_valid) {
+        other._words = nullptr;
+        other._word_capacity = 0;
+        other._size = 0;
+        other._rank_valid = false;
+    }
+
+    /**
+     * @brief Destructor. Releases the word buffer.
+     */
+    inline BitVector::~BitVector() {
+        delete[] _words;
+    }
+
+    /**
+     * @brief Copy assignment operator. Creates a deep copy of another BitVector.
+     */
+    inline BitVector& BitVector::operator=(const BitVector& other) {
+        if (this != &other) { // Avoid self-assignment
+            BitVector copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator. The source is left empty.
+     */
+    inline BitVector& BitVector::operator=(BitVector&& other) noexcept {
+        if (this != &other) {
+            delete[] _words;
+            _words = other._words;
+            _word_capacity = other._word_capacity;
+            _size = other._size;
+            _rank = std::move(other._rank);
+            _rank_valid = other._rank_valid;
+
+            other._words = nullptr;
+            other._word_capacity = 0;
+            other._size = 0;
+            other._rank_valid = false;
+        }
+        return *this;
+    }
+
+    inline BitVector::Reference::Reference(BitVector& owner, size_t index) : _owner(&owner), _index(index) {}
+
+    inline BitVector::Reference& BitVector::Reference::operator=(bool value) {
+        _owner->set(_index, value);
+        return *this;
+    }
+
+    inline BitVector::Reference& BitVector::Reference::operator=(const Reference& other) {
+        return *this = static_cast<bool>(other);
+    }
+
+    inline BitVector::Reference::operator bool() const {
+        return _owner->test(_index);
+    }
+
+    inline void BitVector::Reference::flip() {
+        _owner->flip(_index);
+    }
+
+    /**
+     * @brief Accesses a bit through a proxy reference.
+     * @throws std::out_of_range If the index is out of bounds.
+     */
+    inline BitVector::Reference BitVector::operator[](size_t index) {
+        if (index >= _size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return Reference(*this, index);
+    }
+
+    /**
+     * @brief Reads a bit.
+     * @throws std::out_of_range If the index is out of bounds.
+     */
+    inline bool BitVector::operator[](size_t index) const {
+        return test(index);
+    }
+
+    /**
+     * @brief Reads a bit.
+     * @throws std::out_of_range If the index is out of bounds.
+     */
+    inline bool BitVector::test(size_t index) const {
+        if (index >= _size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return (_words[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+    }
+
+    /**
+     * @brief Sets a bit to `value`.
+     * @throws std::out_of_range If the index is out of bounds.
+     */
+    inline void BitVector::set(size_t index, bool value) {
+        if (index >= _size) {
+            throw std::out_of_range("Index out of range");
+        }
+        uint64_t mask = uint64_t(1) << (index % WORD_BITS);
+        if (value) {
+            _words[index / WORD_BITS] |= mask;
+        } else {
+            _words[index / WORD_BITS] &= ~mask;
+        }
+        _rank_valid = false;
+    }
+
+    /**
+     * @brief Clears a bit.
+     * @throws std::out_of_range If the index is out of bounds.
+     */
+    inline void BitVector::reset(size_t index) {
+        set(index, false);
+    }
+
+    /**
+     * @brief Inverts a bit.
+     * @throws std::out_of_range If the index is out of bounds.
+     */
+    inline void BitVector::flip(size_t index) {
+        if (index >= _size) {
+            throw std::out_of_range("Index out of range");
+        }
+        _words[index / WORD_BITS] ^= uint64_t(1) << (index % WORD_BITS);
+        _rank_valid = false;
+    }
+
+    /**
+     * @brief Appends a bit, doubling the word buffer when it is full.
+     */
+    inline void BitVector::push_back(bool value) {
+        if (_size == _word_capacity * WORD_BITS) {
+            reallocate(_word_capacity == 0 ? 1 : _word_capacity * 2);
+        }
+        ++_size;
+        set(_size - 1, value);
+    }
+
+    /**
+     * @brief Removes the last bit.
+     * @throws std::underflow_error If the BitVector is empty.
+     */
+    inline void BitVector::pop_back() {
+        if (_size == 0) {
+            throw std::underflow_error("BitVector is empty");
+        }
+        reset(_size - 1); // Keep the tail zero
+        --_size;
+    }
+
+    /**
+     * @brief Sets every bit.
+     */
+    inline void BitVector::set() {
+        size_t used = word_count();
+        for (size_t i = 0; i < used; ++i) {
+            _words[i] = ~uint64_t(0);
+        }
+        clear_tail();
+        _rank_valid = false;
+    }
+
+    /**
+     * @brief Clears every bit.
+     */
+    inline void BitVector::reset() {
+        size_t used = word_count();
+        for (size_t i = 0; i < used; ++i) {
+            _words[i] = 0;
+        }
+        _rank_valid = false;
+    }
+
+    /**
+     * @brief Inverts every bit.
+     */
+    inline void BitVector::flip() {
+        size_t used = word_count();
+        for (size_t i = 0; i < used; ++i) {
+            _words[i] = ~_words[i];
+        }
+        clear_tail();
+        _rank_valid = false;
+    }
+
+    /**
+     * @brief Changes the number of bits.
+     * @param bits The new size.
+     * @param value Value of the bits added when growing.
+     */
+    inline void BitVector::resize(size_t bits, bool value) {
+        if (bits < _size) {
+            size_t keep = words_for(bits);
+            for (size_t i = keep; i < word_count(); ++i) {
+                _words[i] = 0;
+            }
+            _size = bits;
+            if (_size > 0) {
+                clear_tail();
+            }
+        } else if (bits > _size) {
+            reserve(bits);
+            size_t old_size = _size;
+            _size = bits;
+            if (value) {
+                // Partial first word, then whole words; the new tail is cleared after
+                size_t first_full = words_for(old_size);
+                if (old_size % WORD_BITS != 0) {
+                    _words[old_size / WORD_BITS] |= ~uint64_t(0) << (old_size % WORD_BITS);
+                }
+                for (size_t i = first_full; i < word_count(); ++i) {
+                    _words[i] = ~uint64_t(0);
+                }
+                clear_tail();
+            }
+        }
+        _rank_valid = false;
+    }
+
+    /**
+     * @brief Removes all bits. Capacity is kept.
+     */
+    inline void BitVector::clear() {
+        reset();
+        _size = 0;
+    }
+
+    /**
+     * @brief Reserves storage for at least `bits` bits.
+     */
+    inline void BitVector::reserve(size_t bits) {
+        if (words_for(bits) > _word_capacity) {
+            reallocate(words_for(bits));
+        }
+    }
+
+    /**
+     * @brief Bitwise AND with another BitVector of the same size.
+     * @throws std::invalid_argument If the sizes differ.
+     */
+    inline BitVector& BitVector::operator&=(const BitVector& other) {
+        check_same_size(other);
+        detail::apply_words<detail::BitOp::And>(_words, other._words, word_count());
+        _rank_valid = false;
+        return *this;
+    }
+
+    /**
+     * @brief Bitwise OR with another BitVector of the same size.
+     * @throws std::invalid_argument If the sizes differ.
+     */
+    inline BitVector& BitVector::operator|=(const BitVector& other) {
+        check_same_size(other);
+        detail::apply_words<detail::BitOp::Or>(_words, other._words, word_count());
+        _rank_valid = false;
+        return *this;
+    }
+
+    /**
+     * @brief Bitwise XOR with another BitVector of the same size.
+     * @throws std::invalid_argument If the sizes differ.
+     */
+    inline BitVector& BitVector::operator^=(const BitVector& other) {
+        check_same_size(other);
+        detail::apply_words<detail::BitOp::Xor>(_words, other._words, word_count());
+        _rank_valid = false;
+        return *this;
+    }
+
+    /**
+     * @brief Clears every bit that is set in `other` (this &= ~other).
+     * @throws std::invalid_argument If the sizes differ.
+     */
+    inline BitVector& BitVector::and_not(const BitVector& other) {
+        check_same_size(other);
+        detail::apply_words<detail::BitOp::AndNot>(_words, other._words, word_count());
+        _rank_valid = false;
+        return *this;
+    }
+
+    inline size_t BitVector::size() const {
+        return _size;
+    }
+
+    inline size_t BitVector::capacity() const {
+        return _word_capacity * WORD_BITS;
+    }
+
+    inline bool BitVector::empty() const {
+        return _size == 0;
+    }
+
+    /**
+     * @brief Counts the set bits, one popcount per word.
+     */
+    inline size_t BitVector::count() const {
+        size_t total = 0;
+        size_t used = word_count();
+        for (size_t i = 0; i < used; ++i) {
+            total += detail::popcount64(_words[i]);
+        }
+        return total;
+    }
+
+    inline bool BitVector::any() const {
+        return find_first() != npos;
+    }
+
+    inline bool BitVector::none() const {
+        return !any();
+    }
+
+    inline bool BitVector::all() const {
+        return count() == _size;
+    }
+
+    /**
+     * @brief Returns the index of the first set bit, or npos if none is set.
+     */
+    inline size_t BitVector::find_first() const {
+        size_t used = word_count();
+        for (size_t i = 0; i < used; ++i) {
+            if (_words[i]) {
+                return i * WORD_BITS + detail::ctz64(_words[i]);
+            }
+        }
+        return npos;
+    }
+
+    /**
+     * @brief Returns the index of the first set bit after `index`, or npos.
+     * Skips whole zero words, so sparse bitmaps are scanned quickly.
+     */
+    inline size_t BitVector::find_next(size_t index) const {
+        size_t start = index + 1;
+        if (index == npos || start >= _size) {
+            return npos;
+        }
+        size_t w = start / WORD_BITS;
+        uint64_t word = _words[w] & (~uint64_t(0) << (start % WORD_BITS));
+        size_t used = word_count();
+        while (true) {
+            if (word) {
+                return w * WORD_BITS + detail::ctz64(word);
+            }
+            if (++w == used) {
+                return npos;
+            }
+            word = _words[w];
+        }
+    }
+
+    /**
+     * @brief Builds the block index used by rank() and select().
+     * Stores the number of set bits before every 512-bit block, plus the total.
+     * Any later modification invalidates it.
+     */
+    inline void BitVector::build_rank_index() {
+        size_t used = word_count();
+        size_t blocks = (used + RANK_BLOCK_WORDS - 1) / RANK_BLOCK_WORDS;
+        _rank = Vector<size_t>(blocks + 1);
+        size_t* rank = _rank.begin();
+        size_t total = 0;
+        for (size_t b = 0; b < blocks; ++b) {
+            rank[b] = total;
+            size_t end = (b + 1) * RANK_BLOCK_WORDS < used ? (b + 1) * RANK_BLOCK_WORDS : used;
+            for (size_t i = b * RANK_BLOCK_WORDS; i < end; ++i) {
+                total += detail::popcount64(_words[i]);
+            }
+        }
+        rank[blocks] = total;
+        _rank_valid = true;
+    }
+
+    /**
+     * @brief Counts the set bits before a position.
+     * O(1) with a valid rank index (one block lookup plus at most 8 popcounts),
+     * O(index / 64) otherwise.
+     * @param index A position in [0, size()].
+     * @throws std::out_of_range If index > size().
+     */
+    inline size_t BitVector::rank(size_t index) const {
+        if (index > _size) {
+            throw std::out_of_range("Index out of range");
+        }
+        size_t word = index / WORD_BITS;
+        size_t total = 0;
+        size_t first_word = 0;
+        if (_rank_valid) {
+            size_t block = word / RANK_BLOCK_WORDS;
+            total = _rank[block];
+            first_word = block * RANK_BLOCK_WORDS;
+        }
+        for (size_t i = first_word; i < word; ++i) {
+            total += detail::popcount64(_words[i]);
+        }
+        if (index % WORD_BITS != 0) {
+            total += detail::popcount64(_words[word] & ((uint64_t(1) << (index % WORD_BITS)) - 1));
+        }
+        return total;
+    }
+
+    /**
+     * @brief Finds the position of the k-th set bit, counting from 0.
+     * With a valid rank index, binary-searches the blocks and scans at most one;
+     * otherwise scans words from the start.
+     * @return The position, or npos if fewer than k + 1 bits are set.
+     */
+    inline size_t BitVector::select(size_t k) const {
+        size_t used = word_count();
+        size_t w = 0;
+        if (_rank_valid) {
+            size_t blocks = _rank.size() - 1;
+            if (k >= _rank[blocks]) {
+                return npos;
+            }
+            // Last block whose leading count is <= k
+            size_t lo = 0, hi = blocks;
+            while (hi - lo > 1) {
+                size_t mid = lo + (hi - lo) / 2;
+                if (_rank[mid] <= k) {
+                    lo = mid;
+                } else {
+                    hi = mid;
+                }
+            }
+            k -= _rank[lo];
+            w = lo * RANK_BLOCK_WORDS;
+        }
+        for (; w < used; ++w) {
+            size_t bits = detail::popcount64(_words[w]);
+            if (k < bits) {
+                return w * WORD_BITS + detail::select64(_words[w], static_cast<unsigned>(k));
+            }
+            k -= bits;
+        }
+        return npos;
+    }
+
+    /**
+     * @brief Returns the packed words (size() bits, unused tail bits zero).
+     */
+    inline const uint64_t* BitVector::words() const {
+        return _words;
+    }
+
+    /**
+     * @brief Equality operator: same size and same bits.
+     */
+    inline bool BitVector::operator==(const BitVector& other) const {
+        if (_size != other._size) {
+            return false;
+        }
+        size_t used = word_count();
+        for (size_t i = 0; i < used; ++i) {
+            if (_words[i] != other._words[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline BitVector operator&(BitVector lhs, const BitVector& rhs) {
+        lhs &= rhs;
+        return lhs;
+    }
+
+    inline BitVector operator|(BitVector lhs, const BitVector& rhs) {
+        lhs |= rhs;
+        return lhs;
+    }
+
+    inline BitVector operator^(BitVector lhs, const BitVector& rhs) {
+        lhs ^= rhs;
+        return lhs;
+    }
+
+} // namespace CustomCXX
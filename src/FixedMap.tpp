@@ -0,0 +1,229 @@
+#include "../include/FixedMap.h"
+
+namespace CustomCXX {
+
+    namespace detail {
+        /**
+         * @brief splitmix64 finalizer: spreads every input bit over the output.
+         */
+        constexpr uint64_t mix64(uint64_t x) {
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ULL;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebULL;
+            x ^= x >> 31;
+            return x;
+        }
+
+        /**
+         * @brief Expands a small seed into a well-mixed 64-bit salt, so that
+         * neighbouring seeds do not merely permute a set of small keys.
+         */
+        constexpr uint64_t seed_salt(uint64_t seed) {
+            return mix64(seed * 0x9e3779b97f4a7c15ULL + 0x632be59bd9b4e019ULL);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Hashes an integral or enum key (salted multiply-shift: one multiply,
+     * high bits used by the caller).
+     */
+    template <typename Key>
+    constexpr uint64_t FixedHash<Key, std::enable_if_t<std::is_integral_v<Key> || std::is_enum_v<Key>>>::operator()(
+        Key key, uint64_t salt) const {
+        return (static_cast<uint64_t>(key) ^ salt) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    /**
+     * @brief Hashes a string (salted FNV-1a plus a final multiply).
+     */
+    constexpr uint64_t FixedHash<std::string_view>::operator()(std::string_view key, uint64_t salt) const {
+        uint64_t hash = 0xcbf29ce484222325ULL ^ salt;
+        for (char c : key) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001b3ULL;
+        }
+        return (hash ^ (hash >> 32)) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    /**
+     * @brief Builds the perfect hash table from an initializer list.
+     *
+     * Buckets are placed largest first, while the table is still mostly empty;
+     * for each one, salts derived from seeds 1, 2, ... are tried until all of
+     * its keys hash to distinct free slots. In a constant expression every
+     * failure below is a compile error.
+     *
+     * @param list Key-value pairs; at most N, with distinct keys.
+     * @throws std::length_error If the list holds more than N entries.
+     * @throws std::invalid_argument If a key appears twice.
+     * @throws std::runtime_error If no collision-free seed is found for a bucket.
+     */
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr FixedMap<Key, Value, N, Hash>::FixedMap(std::initializer_list<std::pair<Key, Value>> list) {
+        if (list.size() > N) {
+            throw std::length_error("FixedMap capacity exceeded");
+        }
+
+        Key keys_in[table_size]{};
+        Value values_in[table_size]{};
+        size_t bucket_in[table_size]{};
+        size_t bucket_sizes[table_size]{};
+        size_t count = 0;
+        size_t largest = 0;
+
+        for (const auto& entry : list) {
+            for (size_t i = 0; i < count; ++i) {
+                if (keys_in[i] == entry.first) {
+                    throw std::invalid_argument("Duplicate key in FixedMap");
+                }
+            }
+            keys_in[count] = entry.first;
+            values_in[count] = entry.second;
+            bucket_in[count] = bucket_of(entry.first);
+            size_t bucket_size = ++bucket_sizes[bucket_in[count]];
+            largest = bucket_size > largest ? bucket_size : largest;
+            ++count;
+        }
+
+        for (size_t want = largest; want > 0; --want) {
+            for (size_t bucket = 0; bucket < table_size; ++bucket) {
+                if (bucket_sizes[bucket] != want) {
+                    continue;
+                }
+
+                size_t members[table_size]{};
+                size_t member_count = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    if (bucket_in[i] == bucket) {
+                        members[member_count++] = i;
+                    }
+                }
+
+                size_t slots[table_size]{};
+                bool placed = false;
+                for (uint32_t seed = 1; seed <= max_seed_attempts && !placed; ++seed) {
+                    uint64_t salt = detail::seed_salt(seed);
+                    placed = true;
+                    for (size_t j = 0; j < member_count && placed; ++j) {
+                        size_t slot = index_of(Hash{}(keys_in[members[j]], salt));
+                        placed = !_used[slot];
+                        for (size_t k = 0; k < j && placed; ++k) {
+                            placed = slots[k] != slot;
+                        }
+                        slots[j] = slot;
+                    }
+                    if (placed) {
+                        _salts[bucket] = salt;
+                    }
+                }
+                if (!placed) {
+                    throw std::runtime_error("FixedMap could not find a collision-free seed");
+                }
+
+                for (size_t j = 0; j < member_count; ++j) {
+                    _used[slots[j]] = true;
+                    _keys[slots[j]] = keys_in[members[j]];
+                    _values[slots[j]] = values_in[members[j]];
+                }
+            }
+        }
+        _size = count;
+    }
+
+    /**
+     * @brief Reduces a hash to a table index using its high bits.
+     */
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr size_t FixedMap<Key, Value, N, Hash>::index_of(uint64_t hash) {
+        return table_bits == 0 ? 0 : static_cast<size_t>(hash >> (64 - table_bits));
+    }
+
+    /**
+     * @brief Computes the first-level bucket of a key (seed 0).
+     */
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr size_t FixedMap<Key, Value, N, Hash>::bucket_of(const Key& key) const {
+        return index_of(Hash{}(key, detail::seed_salt(0)));
+    }
+
+    /**
+     * @brief Computes the only slot a key can occupy.
+     */
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr size_t FixedMap<Key, Value, N, Hash>::slot_of(const Key& key) const {
+        return index_of(Hash{}(key, _salts[bucket_of(key)]));
+    }
+
+    /**
+     * @brief Looks up a key.
+     * @param key The key to search for.
+     * @return Pointer to the associated value, or nullptr if the key is absent.
+     */
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr const Value* FixedMap<Key, Value, N, Hash>::find(const Key& key) const {
+        size_t slot = slot_of(key);
+        return (_used[slot] && _keys[slot] == key) ? &_values[slot] : nullptr;
+    }
+
+    /**
+     * @brief Checks if a given key exists in the FixedMap.
+     */
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr bool FixedMap<Key, Value, N, Hash>::contains(const Key& key) const {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Returns the value associated with a key.
+     * @throws std::out_of_range if the key is not found.
+     */
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr const Value& FixedMap<Key, Value, N, Hash>::at(const Key& key) const {
+        const Value* value = find(key);
+        if (!value) {
+            throw std::out_of_range("Key not found in FixedMap");
+        }
+        return *value;
+    }
+
+    /**
+     * @brief Returns the value associated with a key, or `fallback` if absent.
+     */
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr Value FixedMap<Key, Value, N, Hash>::value_or(const Key& key, const Value& fallback) const {
+        const Value* value = find(key);
+        return value ? *value : fallback;
+    }
+
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr size_t FixedMap<Key, Value, N, Hash>::size() const {
+        return _size;
+    }
+
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr bool FixedMap<Key, Value, N, Hash>::empty() const {
+        return _size == 0;
+    }
+
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr size_t FixedMap<Key, Value, N, Hash>::capacity() {
+        return N;
+    }
+
+    /**
+     * @brief Returns all keys in the FixedMap.
+     * @return A FixedVector containing all keys, in slot order.
+     */
+    template <typename Key, typename Value, size_t N, typename Hash>
+    constexpr FixedVector<Key, N> FixedMap<Key, Value, N, Hash>::keys() const {
+        FixedVector<Key, N> result;
+        for (size_t slot = 0; slot < table_size; ++slot) {
+            if (_used[slot]) {
+                result.push_back(_keys[slot]);
+            }
+        }
+        return result;
+    }
+
+} // namespace CustomCXX
@@ -0,0 +1,262 @@
+#include "../include/FixedVector.h"
+
+namespace CustomCXX {
+
+    /**
+     * @brief Constructs a FixedVector from an initializer list.
+     * @param list An initializer list of at most N elements.
+     * @throws std::length_error If the list holds more than N elements
+     *         (a compile error when evaluated in a constant expression).
+     */
+    template <typename T, size_t N>
+    constexpr FixedVector<T, N>::FixedVector(std::initializer_list<T> list) {
+        if (list.size() > N) {
+            throw std::length_error("FixedVector capacity exceeded");
+        }
+        for (const auto& elem : list) {
+            _data[_size++] = elem;
+        }
+    }
+
+    /**
+     * @brief Accesses an element at the given index (non-const).
+     * Unchecked unless CUSTOMCXX_ASSERT_BOUNDS is 1; use at() for a throwing check.
+     */
+    template <typename T, size_t N>
+    constexpr T& FixedVector<T, N>::operator[](size_t index) {
+        detail::assert_index(index, _size);
+        return _data[index];
+    }
+
+    /**
+     * @brief Accesses an element at the given index (const).
+     * Unchecked unless CUSTOMCXX_ASSERT_BOUNDS is 1; use at() for a throwing check.
+     */
+    template <typename T, size_t N>
+    constexpr const T& FixedVector<T, N>::operator[](size_t index) const {
+        detail::assert_index(index, _size);
+        return _data[index];
+    }
+
+    /**
+     * @brief Accesses an element at the given index with bounds checking (non-const).
+     * @throws std::out_of_range If the index is out of bounds.
+     */
+    template <typename T, size_t N>
+    constexpr T& FixedVector<T, N>::at(size_t index) {
+        if (index >= _size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return _data[index];
+    }
+
+    /**
+     * @brief Accesses an element at the given index with bounds checking (const).
+     * @throws std::out_of_range If the index is out of bounds.
+     */
+    template <typename T, size_t N>
+    constexpr const T& FixedVector<T, N>::at(size_t index) const {
+        if (index >= _size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return _data[index];
+    }
+
+    /**
+     * @brief Returns a writable view of the elements.
+     */
+    template <typename T, size_t N>
+    constexpr Span<T> FixedVector<T, N>::span() {
+        return Span<T>(_data, _size);
+    }
+
+    /**
+     * @brief Returns a read-only view of the elements.
+     */
+    template <typename T, size_t N>
+    constexpr Span<const T> FixedVector<T, N>::span() const {
+        return Span<const T>(_data, _size);
+    }
+
+    /**
+     * @brief Returns the first element.
+     * @throws std::underflow_error If the FixedVector is empty.
+     */
+    template <typename T, size_t N>
+    constexpr T& FixedVector<T, N>::front() {
+        if (_size == 0) {
+            throw std::underflow_error("FixedVector is empty");
+        }
+        return _data[0];
+    }
+
+    template <typename T, size_t N>
+    constexpr const T& FixedVector<T, N>::front() const {
+        if (_size == 0) {
+            throw std::underflow_error("FixedVector is empty");
+        }
+        return _data[0];
+    }
+
+    /**
+     * @brief Returns the last element.
+     * @throws std::underflow_error If the FixedVector is empty.
+     */
+    template <typename T, size_t N>
+    constexpr T& FixedVector<T, N>::back() {
+        if (_size == 0) {
+            throw std::underflow_error("FixedVector is empty");
+        }
+        return _data[_size - 1];
+    }
+
+    template <typename T, size_t N>
+    constexpr const T& FixedVector<T, N>::back() const {
+        if (_size == 0) {
+            throw std::underflow_error("FixedVector is empty");
+        }
+        return _data[_size - 1];
+    }
+
+    /**
+     * @brief Adds an element to the end.
+     * @param value The value to add.
+     * @throws std::length_error If the FixedVector already holds N elements.
+     */
+    template <typename T, size_t N>
+    constexpr void FixedVector<T, N>::push_back(const T& value) {
+        if (_size == N) {
+            throw std::length_error("FixedVector capacity exceeded");
+        }
+        _data[_size++] = value;
+    }
+
+    /**
+     * @brief Removes the last element.
+     * @throws std::underflow_error If the FixedVector is empty.
+     */
+    template <typename T, size_t N>
+    constexpr void FixedVector<T, N>::pop_back() {
+        if (_size == 0) {
+            throw std::underflow_error("FixedVector is empty");
+        }
+        _data[--_size] = T{}; // Release whatever the slot was holding
+    }
+
+    /**
+     * @brief Removes all elements.
+     */
+    template <typename T, size_t N>
+    constexpr void FixedVector<T, N>::clear() {
+        while (_size > 0) {
+            _data[--_size] = T{};
+        }
+    }
+
+    /**
+     * @brief Inserts an element at a specific index.
+     * @param index The index where the element should be inserted.
+     * @param value The value to insert.
+     * @throws std::out_of_range If the index is out of bounds.
+     * @throws std::length_error If the FixedVector is full.
+     */
+    template <typename T, size_t N>
+    constexpr void FixedVector<T, N>::insert(size_t index, const T& value) {
+        if (index > _size) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (_size == N) {
+            throw std::length_error("FixedVector capacity exceeded");
+        }
+
+        // Shift elements to the right
+        for (size_t i = _size; i > index; --i) {
+            _data[i] = std::move(_data[i - 1]);
+        }
+
+        _data[index] = value;
+        ++_size;
+    }
+
+    /**
+     * @brief Removes an element at a specific index.
+     * @param index The index of the element to remove.
+     * @throws std::out_of_range If the index is out of bounds.
+     */
+    template <typename T, size_t N>
+    constexpr void FixedVector<T, N>::erase(size_t index) {
+        if (index >= _size) {
+            throw std::out_of_range("Index out of range");
+        }
+
+        // Shift elements to the left
+        for (size_t i = index; i < _size - 1; ++i) {
+            _data[i] = std::move(_data[i + 1]);
+        }
+
+        _data[--_size] = T{};
+    }
+
+    template <typename T, size_t N>
+    constexpr size_t FixedVector<T, N>::size() const {
+        return _size;
+    }
+
+    template <typename T, size_t N>
+    constexpr bool FixedVector<T, N>::empty() const {
+        return _size == 0;
+    }
+
+    template <typename T, size_t N>
+    constexpr size_t FixedVector<T, N>::capacity() {
+        return N;
+    }
+
+    template <typename T, size_t N>
+    constexpr bool FixedVector<T, N>::full() const {
+        return _size == N;
+    }
+
+    /**
+     * @brief Returns a pointer to the first element.
+     */
+    template <typename T, size_t N>
+    constexpr T* FixedVector<T, N>::begin() {
+        return _data;
+    }
+
+    /**
+     * @brief Returns a pointer to one past the last element.
+     */
+    template <typename T, size_t N>
+    constexpr T* FixedVector<T, N>::end() {
+        return _data + _size;
+    }
+
+    template <typename T, size_t N>
+    constexpr const T* FixedVector<T, N>::begin() const {
+        return _data;
+    }
+
+    template <typename T, size_t N>
+    constexpr const T* FixedVector<T, N>::end() const {
+        return _data + _size;
+    }
+
+    /**
+     * @brief Element-wise equality; sizes must match.
+     */
+    template <typename T, size_t N>
+    constexpr bool FixedVector<T, N>::operator==(const FixedVector& other) const {
+        if (_size != other._size) {
+            return false;
+        }
+        for (size_t i = 0; i < _size; ++i) {
+            if (!(_data[i] == other._data[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace CustomCXX
@@ -19,6 +19,62 @@ namespace CustomCXX {
         }
     }
 
+    /**
+     * @brief Copy constructor for List.
+     * Creates a deep copy of another List.
+     * @param other The List to copy from.
+     */
+    template <typename T>
+    List<T>::List(const List& other) : head(nullptr), tail(nullptr), list_size(0) {
+        for (Node* current = other.head; current; current = current->next) {
+            push_back(current->value);
+        }
+    }
+
+    /**
+     * @brief Move constructor for List.
+     * @param other The List to move from; it is left empty.
+     */
+    template <typename T>
+    List<T>::List(List&& other) noexcept : head(other.head), tail(other.tail), list_size(other.list_size) {
+        other.head = other.tail = nullptr;
+        other.list_size = 0;
+    }
+
+    /**
+     * @brief Copy assignment operator for List.
+     * Creates a deep copy of another List.
+     * @param other The List to copy from.
+     * @return A reference to the assigned List.
+     */
+    template <typename T>
+    List<T>& List<T>::operator=(const List& other) {
+        if (this != &other) { // Avoid self-assignment
+            List copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator for List.
+     * @param other The List to move from; it is left empty.
+     * @return A reference to the assigned List.
+     */
+    template <typename T>
+    List<T>& List<T>::operator=(List&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head = other.head;
+            tail = other.tail;
+            list_size = other.list_size;
+
+            other.head = other.tail = nullptr;
+            other.list_size = 0;
+        }
+        return *this;
+    }
+
     /**
      * @brief Destructor to clean up all nodes in the List.
      */
@@ -35,6 +91,7 @@ namespace CustomCXX {
     void List<T>::push_front(const T& value) {
         Node* new_node = new Node(value);
         new_node->next = head;
+        if (head) head->prev = new_node;
         head = new_node;
         if (!tail) tail = new_node; // If list was empty, tail is also updated
         ++list_size;
@@ -67,7 +124,11 @@ namespace CustomCXX {
         Node* temp = head;
         head = head->next;
         delete temp;
-        if (!head) tail = nullptr; // If the list becomes empty
+        if (head) {
+            head->prev = nullptr;
+        } else {
+            tail = nullptr; // If the list becomes empty
+        }
         --list_size;
     }
 
@@ -82,12 +143,9 @@ namespace CustomCXX {
             delete head;
             head = tail = nullptr;
         } else {
-            Node* current = head;
-            while (current->next != tail) {
-                current = current->next;
-            }
+            Node* new_tail = tail->prev;
             delete tail;
-            tail = current;
+            tail = new_tail;
             tail->next = nullptr;
         }
         --list_size;
@@ -290,6 +348,57 @@ namespace CustomCXX {
         tail = temp;
     }
 
+    /**
+     * @brief Removes a node in O(1), without walking the List.
+     * @param node A node of this List, as reached from begin() or rbegin().
+     *        It is deleted, so it must not be used afterwards.
+     * @throws std::invalid_argument If node is null.
+     */
+    template <typename T>
+    void List<T>::erase_node(Node* node) {
+        if (!node) throw std::invalid_argument("Cannot erase a null node");
+        unlink(node);
+        delete node;
+        --list_size;
+    }
+
+    /**
+     * @brief Moves a node to the front of the List in O(1).
+     * Useful for recency lists: the node, and pointers to it, stay valid.
+     * @param node A node of this List, as reached from begin() or rbegin().
+     * @throws std::invalid_argument If node is null.
+     */
+    template <typename T>
+    void List<T>::move_to_front(Node* node) {
+        if (!node) throw std::invalid_argument("Cannot move a null node");
+        if (node == head) {
+            return;
+        }
+        unlink(node);
+        node->next = head;
+        head->prev = node; // head is non-null: node was not the only element
+        head = node;
+    }
+
+    /**
+     * @brief Detaches a node from its neighbours without deleting it.
+     * Fixes up head and tail; list_size is left to the caller.
+     */
+    template <typename T>
+    void List<T>::unlink(Node* node) {
+        if (node->prev) {
+            node->prev->next = node->next;
+        } else {
+            head = node->next;
+        }
+        if (node->next) {
+            node->next->prev = node->prev;
+        } else {
+            tail = node->prev;
+        }
+        node->prev = node->next = nullptr;
+    }
+
     /**
      * @brief Returns an iterator pointing to the beginning of the List.
      * @return A pointer to the first node in the List.
@@ -403,7 +512,7 @@ namespace CustomCXX {
      */
     template <typename T>
     void List<T>::sort() {
-        head = merge_sort(head, std::less<T>());
+        sort(std::less<T>());
     }
 
     /**
@@ -415,6 +524,14 @@ namespace CustomCXX {
     template <typename Compare>
     void List<T>::sort(Compare comp) {
         head = merge_sort(head, comp);
+
+        // merge() only links forward; restore the prev links and the tail
+        Node* previous = nullptr;
+        for (Node* current = head; current; current = current->next) {
+            current->prev = previous;
+            previous = current;
+        }
+        tail = previous;
     }
 
     /**
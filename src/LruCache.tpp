@@ -0,0 +1,655 @@
+#include "../include/LruCache.h"
+
+namespace CustomCXX {
+
+    /**
+     * @brief Builds a node holding a key-value pair and its bookkeeping.
+     */
+    template <typename Key, typename Value, typename Hash>
+    template <typename V>
+    LruCache<Key, Value, Hash>::Node::Node(const Key& key, V&& value, size_t hash, size_t weight)
+        : key(key), value(std::forward<V>(value)), hash(hash), weight(weight),
+          chain(nullptr), prev(nullptr), next(nullptr) {}
+
+    /**
+     * @brief Constructs a cache holding at most `capacity` entries.
+     * @param capacity Maximum number of entries.
+     * @param policy Replacement policy.
+     * @throws std::invalid_argument If capacity is 0.
+     */
+    template <typename Key, typename Value, typename Hash>
+    LruCache<Key, Value, Hash>::LruCache(size_t capacity, EvictionPolicy policy)
+        : LruCache(capacity, Weigher(), policy) {}
+
+    /**
+     * @brief Constructs a cache bounded by the total weight of its entries.
+     * @param max_weight Maximum total weight, e.g. in bytes.
+     * @param weigher Returns the weight of an entry; it is called once per put().
+     *        If empty, every entry weighs 1 and max_weight is an entry count.
+     * @param policy Replacement policy.
+     * @throws std::invalid_argument If max_weight is 0.
+     */
+    template <typename Key, typename Value, typename Hash>
+    LruCache<Key, Value, Hash>::LruCache(size_t max_weight, Weigher weigher, EvictionPolicy policy)
+        : _buckets(nullptr), _bucket_count(0), _bucket_shift(64), _head(nullptr), _tail(nullptr),
+          _hand(nullptr), _size(0), _weight(0), _max_weight(max_weight), _policy(policy),
+          _weigher(std::move(weigher)) {
+        if (max_weight == 0) {
+            throw std::invalid_argument("LruCache capacity must be positive");
+        }
+        grow();
+    }
+
+    /**
+     * @brief Move constructor for LruCache.
+     * The moved-from cache is left empty and usable with the same bound; its
+     * weigher and eviction callback move with the entries.
+     * @param other The cache to move from.
+     */
+    template <typename Key, typename Value, typename Hash>
+    LruCache<Key, Value, Hash>::LruCache(LruCache&& other) noexcept
+        : _buckets(other._buckets), _bucket_count(other._bucket_count), _bucket_shift(other._bucket_shift),
+          _head(other._head), _tail(other._tail), _hand(other._hand), _size(other._size),
+          _weight(other._weight), _max_weight(other._max_weight), _policy(other._policy),
+          _weigher(std::move(other._weigher)), _on_evict(std::move(other._on_evict)) {
+        other._buckets = nullptr; // Reallocated by the next put()
+        other._bucket_count = 0;
+        other._bucket_shift = 64;
+        other._head = other._tail = other._hand = nullptr;
+        other._size = 0;
+        other._weight = 0;
+    }
+
+    /**
+     * @brief Destructor; frees every entry without invoking the eviction callback.
+     */
+    template <typename Key, typename Value, typename Hash>
+    LruCache<Key, Value, Hash>::~LruCache() {
+        destroy_all();
+        delete[] _buckets;
+    }
+
+    /**
+     * @brief Move assignment operator for LruCache.
+     * @param other The cache to move from; it is left empty and usable.
+     * @return A reference to the assigned cache.
+     */
+    template <typename Key, typename Value, typename Hash>
+    LruCache<Key, Value, Hash>& LruCache<Key, Value, Hash>::operator=(LruCache&& other) noexcept {
+        if (this != &other) {
+            destroy_all();
+            delete[] _buckets;
+
+            _buckets = other._buckets;
+            _bucket_count = other._bucket_count;
+            _bucket_shift = other._bucket_shift;
+            _head = other._head;
+            _tail = other._tail;
+            _hand = other._hand;
+            _size = other._size;
+            _weight = other._weight;
+            _max_weight = other._max_weight;
+            _policy = other._policy;
+            _weigher = std::move(other._weigher);
+            _on_evict = std::move(other._on_evict);
+
+            other._buckets = nullptr;
+            other._bucket_count = 0;
+            other._bucket_shift = 64;
+            other._head = other._tail = other._hand = nullptr;
+            other._size = 0;
+            other._weight = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Multiplicative mixing, so that the high bits used for bucket
+     *        selection depend on every bit of the (often identity) std::hash.
+     */
+    template <typename Key, typename Value, typename Hash>
+    size_t LruCache<Key, Value, Hash>::mix(size_t hash) {
+        return static_cast<size_t>(static_cast<uint64_t>(hash) * 0x9e3779b97f4a7c15ull);
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    size_t LruCache<Key, Value, Hash>::bucket_of(size_t hash) const {
+        return static_cast<size_t>(static_cast<uint64_t>(hash) >> _bucket_shift);
+    }
+
+    /**
+     * @brief Looks a key up in its hash chain.
+     * @param key The key to find.
+     * @param hash mix(Hash{}(key)).
+     * @return The node holding key, or nullptr.
+     */
+    template <typename Key, typename Value, typename Hash>
+    typename LruCache<Key, Value, Hash>::Node* LruCache<Key, Value, Hash>::find_node(const Key& key, size_t hash) const {
+        if (_bucket_count == 0) {
+            return nullptr; // Moved-from
+        }
+        for (Node* node = _buckets[bucket_of(hash)]; node; node = node->chain) {
+            if (node->hash == hash && node->key == key) {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Records a use of an entry according to the policy.
+     * LRU relinks the node at the front; Clock only sets its reference bit.
+     */
+    template <typename Key, typename Value, typename Hash>
+    void LruCache<Key, Value, Hash>::mark_used(Node* node) {
+        if (_policy == EvictionPolicy::Clock) {
+            node->referenced.store(true, std::memory_order_relaxed);
+        } else if (node != _head) {
+            unlink(node);
+            link(node);
+        }
+    }
+
+    /**
+     * @brief Adds a node to the recency list.
+     * LRU puts it at the front. Clock puts it just behind the hand, so it is
+     * the last entry the hand reaches.
+     */
+    template <typename Key, typename Value, typename Hash>
+    void LruCache<Key, Value, Hash>::link(Node* node) {
+        Node* before = _policy == EvictionPolicy::Clock ? _hand : _head; // Node to insert in front of
+
+        node->next = before;
+        node->prev = before ? before->prev : _tail;
+        if (node->prev) {
+            node->prev->next = node;
+        } else {
+            _head = node;
+        }
+        if (before) {
+            before->prev = node;
+        } else {
+            _tail = node;
+        }
+        if (_policy == EvictionPolicy::Clock && !_hand) {
+            _hand = node;
+        }
+    }
+
+    /**
+     * @brief Removes a node from the recency list, moving the Clock hand off it.
+     */
+    template <typename Key, typename Value, typename Hash>
+    void LruCache<Key, Value, Hash>::unlink(Node* node) {
+        if (node == _hand) {
+            _hand = node->next ? node->next : _head;
+            if (_hand == node) {
+                _hand = nullptr; // It was the only node
+            }
+        }
+        if (node->prev) {
+            node->prev->next = node->next;
+        } else {
+            _head = node->next;
+        }
+        if (node->next) {
+            node->next->prev = node->prev;
+        } else {
+            _tail = node->prev;
+        }
+        node->prev = node->next = nullptr;
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    void LruCache<Key, Value, Hash>::chain_insert(Node* node) {
+        Node*& bucket = _buckets[bucket_of(node->hash)];
+        node->chain = bucket;
+        bucket = node;
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    void LruCache<Key, Value, Hash>::chain_remove(Node* node) {
+        Node** link = &_buckets[bucket_of(node->hash)];
+        while (*link != node) {
+            link = &(*link)->chain;
+        }
+        *link = node->chain;
+    }
+
+    /**
+     * @brief Doubles the bucket count (or allocates the initial buckets) and
+     *        redistributes the chains. Nodes are relinked, not reallocated.
+     */
+    template <typename Key, typename Value, typename Hash>
+    void LruCache<Key, Value, Hash>::grow() {
+        size_t new_count = _bucket_count ? _bucket_count * 2 : INITIAL_BUCKETS;
+        Node** new_buckets = new Node*[new_count]();
+
+        Node** old_buckets = _buckets;
+        size_t old_count = _bucket_count;
+        _buckets = new_buckets;
+        _bucket_count = new_count;
+        _bucket_shift = 64;
+        for (size_t n = new_count; n > 1; n >>= 1) {
+            --_bucket_shift;
+        }
+
+        for (size_t i = 0; i < old_count; ++i) {
+            Node* node = old_buckets[i];
+            while (node) {
+                Node* next = node->chain;
+                chain_insert(node);
+                node = next;
+            }
+        }
+        delete[] old_buckets;
+    }
+
+    /**
+     * @brief Evicts one entry according to the policy and reports it to the
+     *        eviction callback.
+     * @param keep A node that must survive (the entry being inserted), or nullptr.
+     */
+    template <typename Key, typename Value, typename Hash>
+    void LruCache<Key, Value, Hash>::evict_one(const Node* keep) {
+        Node* victim = nullptr;
+        if (_policy == EvictionPolicy::Clock) {
+            // Second chance: clear reference bits until an unreferenced entry is found
+            while (!victim) {
+                if (_hand != keep && !_hand->referenced.exchange(false, std::memory_order_relaxed)) {
+                    victim = _hand;
+                }
+                _hand = _hand->next ? _hand->next : _head;
+            }
+        } else {
+            victim = _tail == keep ? keep->prev : _tail;
+        }
+
+        chain_remove(victim);
+        unlink(victim);
+        --_size;
+        _weight -= victim->weight;
+
+        std::unique_ptr<Node> owned(victim); // Freed even if the callback throws
+        if (_on_evict) {
+            _on_evict(victim->key, victim->value);
+        }
+    }
+
+    /**
+     * @brief Deletes every node; buckets and counters are left to the caller.
+     */
+    template <typename Key, typename Value, typename Hash>
+    void LruCache<Key, Value, Hash>::destroy_all() {
+        Node* node = _head;
+        while (node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+        _head = _tail = _hand = nullptr;
+    }
+
+    /**
+     * @brief Inserts or assigns, then evicts entries until the bound holds.
+     * @param key The key to insert or assign.
+     * @param hash mix(Hash{}(key)).
+     * @param value The value, copied or moved into the node.
+     * @return false if the entry alone exceeds the bound; it is then not
+     *         stored, and any previous value for key is erased.
+     */
+    template <typename Key, typename Value, typename Hash>
+    template <typename V>
+    bool LruCache<Key, Value, Hash>::put_impl(const Key& key, size_t hash, V&& value) {
+        size_t weight = _weigher ? _weigher(key, value) : 1;
+        Node* node = find_node(key, hash);
+
+        if (weight > _max_weight) {
+            if (node) {
+                chain_remove(node);
+                unlink(node);
+                --_size;
+                _weight -= node->weight;
+                delete node;
+            }
+            return false;
+        }
+
+        if (node) {
+            node->value = std::forward<V>(value);
+            _weight = _weight - node->weight + weight;
+            node->weight = weight;
+            mark_used(node);
+        } else {
+            if (_bucket_count == 0 || _size >= _bucket_count) {
+                grow(); // Before allocating the node, so a failure leaves nothing behind
+            }
+            node = new Node(key, std::forward<V>(value), hash, weight);
+            chain_insert(node);
+            link(node);
+            ++_size;
+            _weight += weight;
+        }
+
+        while (_weight > _max_weight) {
+            evict_one(node);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Looks up a key and marks the entry used.
+     * @param key The key to look up.
+     * @return A pointer to the cached value, or nullptr on a miss.
+     */
+    template <typename Key, typename Value, typename Hash>
+    Value* LruCache<Key, Value, Hash>::get(const Key& key) {
+        Node* node = find_node(key, mix(Hash{}(key)));
+        if (!node) {
+            return nullptr;
+        }
+        mark_used(node);
+        return &node->value;
+    }
+
+    /**
+     * @brief Looks up a key without affecting eviction order.
+     * @param key The key to look up.
+     * @return A pointer to the cached value, or nullptr on a miss.
+     */
+    template <typename Key, typename Value, typename Hash>
+    const Value* LruCache<Key, Value, Hash>::peek(const Key& key) const {
+        Node* node = find_node(key, mix(Hash{}(key)));
+        return node ? &node->value : nullptr;
+    }
+
+    /**
+     * @brief Checks if a key is cached, without affecting eviction order.
+     */
+    template <typename Key, typename Value, typename Hash>
+    bool LruCache<Key, Value, Hash>::contains(const Key& key) const {
+        return find_node(key, mix(Hash{}(key))) != nullptr;
+    }
+
+    /**
+     * @brief Marks an entry used without reading it.
+     * @return true if the key was cached.
+     */
+    template <typename Key, typename Value, typename Hash>
+    bool LruCache<Key, Value, Hash>::touch(const Key& key) {
+        return get(key) != nullptr;
+    }
+
+    /**
+     * @brief Inserts a new entry or assigns to an existing one, marking it used.
+     * Older entries are then evicted until the bound holds again.
+     * @param key The key to insert or assign.
+     * @param value The value to cache.
+     * @return false if the entry alone exceeds the bound (see put_impl).
+     */
+    template <typename Key, typename Value, typename Hash>
+    bool LruCache<Key, Value, Hash>::put(const Key& key, const Value& value) {
+        return put_impl(key, mix(Hash{}(key)), value);
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    bool LruCache<Key, Value, Hash>::put(const Key& key, Value&& value) {
+        return put_impl(key, mix(Hash{}(key)), std::move(value));
+    }
+
+    /**
+     * @brief Removes an entry, without invoking the eviction callback.
+     * @param key The key to erase.
+     * @return false if the key was not cached.
+     */
+    template <typename Key, typename Value, typename Hash>
+    bool LruCache<Key, Value, Hash>::erase(const Key& key) {
+        Node* node = find_node(key, mix(Hash{}(key)));
+        if (!node) {
+            return false;
+        }
+        chain_remove(node);
+        unlink(node);
+        --_size;
+        _weight -= node->weight;
+        delete node;
+        return true;
+    }
+
+    /**
+     * @brief Removes all entries, without invoking the eviction callback.
+     */
+    template <typename Key, typename Value, typename Hash>
+    void LruCache<Key, Value, Hash>::clear() {
+        destroy_all();
+        for (size_t i = 0; i < _bucket_count; ++i) {
+            _buckets[i] = nullptr;
+        }
+        _size = 0;
+        _weight = 0;
+    }
+
+    /**
+     * @brief Sets the function called with each entry evicted to respect the bound.
+     * It runs before the entry is freed, may move the value out, and must not
+     * modify the cache.
+     */
+    template <typename Key, typename Value, typename Hash>
+    void LruCache<Key, Value, Hash>::set_eviction_callback(EvictionCallback callback) {
+        _on_evict = std::move(callback);
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    size_t LruCache<Key, Value, Hash>::size() const {
+        return _size;
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    bool LruCache<Key, Value, Hash>::empty() const {
+        return _size == 0;
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    size_t LruCache<Key, Value, Hash>::capacity() const {
+        return _max_weight;
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    size_t LruCache<Key, Value, Hash>::weight() const {
+        return _weight;
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    EvictionPolicy LruCache<Key, Value, Hash>::policy() const {
+        return _policy;
+    }
+
+    // ShardedLruCache
+
+    template <typename Key, typename Value, typename Hash>
+    template <typename... Args>
+    ShardedLruCache<Key, Value, Hash>::Shard::Shard(Args&&... args) : cache(std::forward<Args>(args)...) {}
+
+    /**
+     * @brief Constructs a sharded cache holding about `capacity` entries.
+     * @param capacity Total entry bound, split evenly (rounded up) between shards.
+     * @param shard_count Number of independently locked shards; 0 is treated as 1.
+     * @param policy Replacement policy of every shard.
+     */
+    template <typename Key, typename Value, typename Hash>
+    ShardedLruCache<Key, Value, Hash>::ShardedLruCache(size_t capacity, size_t shard_count, EvictionPolicy policy)
+        : ShardedLruCache(capacity, typename Cache::Weigher(), shard_count, policy) {}
+
+    /**
+     * @brief Constructs a sharded cache bounded by total weight.
+     * @param max_weight Total weight bound, split evenly (rounded up) between shards.
+     * @param weigher Weight of an entry; see LruCache.
+     * @param shard_count Number of independently locked shards; 0 is treated as 1.
+     * @param policy Replacement policy of every shard.
+     * @throws std::invalid_argument If max_weight is 0.
+     */
+    template <typename Key, typename Value, typename Hash>
+    ShardedLruCache<Key, Value, Hash>::ShardedLruCache(size_t max_weight, typename Cache::Weigher weigher,
+                                                       size_t shard_count, EvictionPolicy policy)
+        : _policy(policy) {
+        if (shard_count == 0) {
+            shard_count = 1;
+        }
+        size_t bound = per_shard(max_weight, shard_count);
+        _shards.reserve(shard_count);
+        for (size_t i = 0; i < shard_count; ++i) {
+            _shards.push_back(std::make_unique<Shard>(bound, weigher, policy));
+        }
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    size_t ShardedLruCache<Key, Value, Hash>::per_shard(size_t bound, size_t shard_count) {
+        if (bound == 0) {
+            throw std::invalid_argument("LruCache capacity must be positive");
+        }
+        return (bound + shard_count - 1) / shard_count;
+    }
+
+    /**
+     * @brief Picks a shard from the mixed hash's middle bits; the shard's
+     *        buckets use the top bits, so the two choices stay independent.
+     */
+    template <typename Key, typename Value, typename Hash>
+    typename ShardedLruCache<Key, Value, Hash>::Shard& ShardedLruCache<Key, Value, Hash>::shard_for(size_t hash) const {
+        return *_shards[static_cast<size_t>(static_cast<uint64_t>(hash) >> 24) % _shards.size()];
+    }
+
+    /**
+     * @brief Looks up a key and marks the entry used.
+     * @return A copy of the cached value, or std::nullopt on a miss.
+     */
+    template <typename Key, typename Value, typename Hash>
+    std::optional<Value> ShardedLruCache<Key, Value, Hash>::get(const Key& key) {
+        size_t hash = Cache::mix(Hash{}(key));
+        Shard& shard = shard_for(hash);
+
+        if (_policy == EvictionPolicy::Clock) {
+            // Setting the atomic reference bit is the only write a Clock hit makes
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            auto* node = shard.cache.find_node(key, hash);
+            if (!node) {
+                return std::nullopt;
+            }
+            node->referenced.store(true, std::memory_order_relaxed);
+            return node->value;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto* node = shard.cache.find_node(key, hash);
+        if (!node) {
+            return std::nullopt;
+        }
+        shard.cache.mark_used(node);
+        return node->value;
+    }
+
+    /**
+     * @brief Marks an entry used without copying its value.
+     * Takes only a shared lock under the Clock policy, like get().
+     * @return false if the key is absent.
+     */
+    template <typename Key, typename Value, typename Hash>
+    bool ShardedLruCache<Key, Value, Hash>::touch(const Key& key) {
+        size_t hash = Cache::mix(Hash{}(key));
+        Shard& shard = shard_for(hash);
+
+        if (_policy == EvictionPolicy::Clock) {
+            std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            auto* node = shard.cache.find_node(key, hash);
+            if (!node) {
+                return false;
+            }
+            node->referenced.store(true, std::memory_order_relaxed);
+            return true;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto* node = shard.cache.find_node(key, hash);
+        if (!node) {
+            return false;
+        }
+        shard.cache.mark_used(node);
+        return true;
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    bool ShardedLruCache<Key, Value, Hash>::contains(const Key& key) const {
+        size_t hash = Cache::mix(Hash{}(key));
+        Shard& shard = shard_for(hash);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.cache.find_node(key, hash) != nullptr;
+    }
+
+    /**
+     * @brief Inserts or assigns in the key's shard, evicting within that shard.
+     * @return false if the entry alone exceeds a shard's bound.
+     */
+    template <typename Key, typename Value, typename Hash>
+    bool ShardedLruCache<Key, Value, Hash>::put(const Key& key, const Value& value) {
+        size_t hash = Cache::mix(Hash{}(key));
+        Shard& shard = shard_for(hash);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.cache.put_impl(key, hash, value);
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    bool ShardedLruCache<Key, Value, Hash>::put(const Key& key, Value&& value) {
+        size_t hash = Cache::mix(Hash{}(key));
+        Shard& shard = shard_for(hash);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.cache.put_impl(key, hash, std::move(value));
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    bool ShardedLruCache<Key, Value, Hash>::erase(const Key& key) {
+        Shard& shard = shard_for(Cache::mix(Hash{}(key)));
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.cache.erase(key);
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    void ShardedLruCache<Key, Value, Hash>::clear() {
+        for (auto& shard : _shards) {
+            std::unique_lock<std::shared_mutex> lock(shard->mutex);
+            shard->cache.clear();
+        }
+    }
+
+    /**
+     * @brief Sets the eviction callback of every shard.
+     * It may be called concurrently from different shards.
+     */
+    template <typename Key, typename Value, typename Hash>
+    void ShardedLruCache<Key, Value, Hash>::set_eviction_callback(typename Cache::EvictionCallback callback) {
+        for (auto& shard : _shards) {
+            std::unique_lock<std::shared_mutex> lock(shard->mutex);
+            shard->cache.set_eviction_callback(callback);
+        }
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    size_t ShardedLruCache<Key, Value, Hash>::size() const {
+        size_t total = 0;
+        for (const auto& shard : _shards) {
+            std::shared_lock<std::shared_mutex> lock(shard->mutex);
+            total += shard->cache.size();
+        }
+        return total;
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    size_t ShardedLruCache<Key, Value, Hash>::capacity() const {
+        return _shards.front()->cache.capacity() * _shards.size();
+    }
+
+    template <typename Key, typename Value, typename Hash>
+    size_t ShardedLruCache<Key, Value, Hash>::shard_count() const {
+        return _shards.size();
+    }
+
+} // namespace CustomCXX
@@ -5,11 +5,194 @@ namespace CustomCXX {
 
     /**
      * @brief Constructs a Map with a given bucket count.
-     * @param bucket_count Number of buckets for the hash table. Defaults to 16.
+     * @param bucket_count Number of buckets for the hash table. Defaults to 16;
+     *        0 is treated as 1.
      */
     template <typename Key, typename Value>
     Map<Key, Value>::Map(size_t bucket_count)
-        : buckets(bucket_count), bucket_count(bucket_count), size_(0) {}
+        : groups(make_table(bucket_count == 0 ? 1 : bucket_count)),
+          bucket_count(bucket_count == 0 ? 1 : bucket_count), size_(0) {}
+
+    /**
+     * @brief Constructs a Map around an existing (possibly shared) group table.
+     */
+    template <typename Key, typename Value>
+    Map<Key, Value>::Map(std::shared_ptr<GroupTable> groups, size_t bucket_count, size_t size)
+        : groups(std::move(groups)), bucket_count(bucket_count), size_(size) {}
+
+    /**
+     * @brief Copy constructor for Map.
+     * Creates a deep copy of another Map; use snapshot() to share instead.
+     * @param other The Map to copy from.
+     */
+    template <typename Key, typename Value>
+    Map<Key, Value>::Map(const Map& other)
+        : groups(other.groups ? clone_table(*other.groups) : nullptr), bucket_count(other.bucket_count),
+          size_(other.size_) {}
+
+    /**
+     * @brief Move constructor for Map.
+     * The moved-from Map is left empty and usable, without a table; its
+     * first write allocates one, so moving never allocates.
+     * @param other The Map to move from.
+     */
+    template <typename Key, typename Value>
+    Map<Key, Value>::Map(Map&& other) noexcept
+        : groups(std::move(other.groups)), bucket_count(other.bucket_count), size_(other.size_) {
+        other.bucket_count = 1;
+        other.size_ = 0;
+    }
+
+    /**
+     * @brief Copy assignment operator for Map.
+     * Creates a deep copy of another Map.
+     * @param other The Map to copy from.
+     * @return A reference to the assigned Map.
+     */
+    template <typename Key, typename Value>
+    Map<Key, Value>& Map<Key, Value>::operator=(const Map& other) {
+        if (this != &other) { // Avoid self-assignment
+            groups = other.groups ? clone_table(*other.groups) : nullptr;
+            bucket_count = other.bucket_count;
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator for Map.
+     * @param other The Map to move from; it is left empty and usable.
+     * @return A reference to the assigned Map.
+     */
+    template <typename Key, typename Value>
+    Map<Key, Value>& Map<Key, Value>::operator=(Map&& other) noexcept {
+        if (this != &other) {
+            groups = std::move(other.groups);
+            bucket_count = other.bucket_count;
+            size_ = other.size_;
+
+            other.bucket_count = 1; // std::move left other.groups null
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Returns a Map sharing all of this Map's buckets, in O(1).
+     *
+     * Shared bucket groups are immutable. The first write through either Map
+     * copies the table of group pointers and then only the group of
+     * BUCKETS_PER_GROUP buckets being written; untouched groups stay shared.
+     * Snapshots may be taken concurrently and handed to other threads.
+     *
+     * Taking a snapshot invalidates references previously returned by this
+     * Map's operator[]: they point into buckets that are now shared, so
+     * writing through them would also change the snapshot. Look the key up
+     * again after the call.
+     *
+     * @return A Map equal to this one that shares its memory.
+     */
+    template <typename Key, typename Value>
+    Map<Key, Value> Map<Key, Value>::snapshot() const {
+        return Map(groups, bucket_count, size_);
+    }
+
+    /**
+     * @brief Reports whether any part of the table is shared with a snapshot.
+     */
+    template <typename Key, typename Value>
+    bool Map<Key, Value>::is_shared() const {
+        if (!groups) {
+            return false;
+        }
+        if (groups.use_count() > 1) {
+            return true;
+        }
+        for (const auto& group : *groups) {
+            if (group.use_count() > 1) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Allocates a table of empty bucket groups.
+     * @param bucket_count Number of buckets the groups must cover.
+     */
+    template <typename Key, typename Value>
+    std::shared_ptr<typename Map<Key, Value>::GroupTable> Map<Key, Value>::make_table(size_t bucket_count) {
+        auto table = std::make_shared<GroupTable>();
+        size_t group_count = (bucket_count + BUCKETS_PER_GROUP - 1) / BUCKETS_PER_GROUP;
+        table->reserve(group_count);
+        for (size_t i = 0; i < group_count; ++i) {
+            auto group = std::make_shared<BucketGroup>();
+            group->buckets.resize(std::min(BUCKETS_PER_GROUP, bucket_count - i * BUCKETS_PER_GROUP));
+            table->push_back(std::move(group));
+        }
+        return table;
+    }
+
+    /**
+     * @brief Copies every bucket group into a new, unshared table.
+     */
+    template <typename Key, typename Value>
+    std::shared_ptr<typename Map<Key, Value>::GroupTable> Map<Key, Value>::clone_table(const GroupTable& table) {
+        auto copy = std::make_shared<GroupTable>();
+        copy->reserve(table.size());
+        for (const auto& group : table) {
+            copy->push_back(std::make_shared<BucketGroup>(*group));
+        }
+        return copy;
+    }
+
+    /**
+     * @brief Returns an empty bucket for Maps left without a table by a move.
+     * A default-constructed std::list does not allocate.
+     */
+    template <typename Key, typename Value>
+    const std::list<typename Map<Key, Value>::Node>& Map<Key, Value>::empty_bucket() {
+        static const std::list<Node> bucket;
+        return bucket;
+    }
+
+    /**
+     * @brief Returns a bucket for reading.
+     * @param index Bucket index, below bucket_count.
+     */
+    template <typename Key, typename Value>
+    const std::list<typename Map<Key, Value>::Node>& Map<Key, Value>::bucket(size_t index) const {
+        if (!groups) {
+            return empty_bucket();
+        }
+        return (*groups)[index / BUCKETS_PER_GROUP]->buckets[index % BUCKETS_PER_GROUP];
+    }
+
+    /**
+     * @brief Returns a bucket for writing.
+     * A group table or bucket group that still has other owners is copied
+     * first; only the group holding this bucket is cloned.
+     * @param index Bucket index, below bucket_count.
+     */
+    template <typename Key, typename Value>
+    std::list<typename Map<Key, Value>::Node>& Map<Key, Value>::mutable_bucket(size_t index) {
+        if (!groups) {
+            groups = make_table(bucket_count); // Moved-from Map written again
+        } else if (groups.use_count() > 1) {
+            groups = std::make_shared<GroupTable>(*groups); // Copies group pointers only
+        } else {
+            // Pairs with the release in the last other owner's reference drop
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+
+        auto& group = (*groups)[index / BUCKETS_PER_GROUP];
+        if (group.use_count() > 1) {
+            group = std::make_shared<BucketGroup>(*group);
+        } else {
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return group->buckets[index % BUCKETS_PER_GROUP];
+    }
 
     /**
      * @brief Checks if a given key exists in the Map.
@@ -19,9 +202,9 @@ namespace CustomCXX {
     template <typename Key, typename Value>
     bool Map<Key, Value>::contains(const Key& key) const {
         size_t bucket_index = hash(key);
-        const auto& bucket = buckets[bucket_index];
+        const auto& nodes = bucket(bucket_index);
 
-        for (const auto& node : bucket) {
+        for (const auto& node : nodes) {
             if (node.key == key) {
                 return true; // Key found
             }
@@ -30,6 +213,24 @@ namespace CustomCXX {
         return false; // Key not found
     }
 
+    /**
+     * @brief Returns the value associated with an existing key.
+     * Unlike operator[], this never inserts and never copies shared buckets.
+     * @param key The key to look up.
+     * @return A const reference to the associated value.
+     * @throws std::out_of_range if the key is not found.
+     */
+    template <typename Key, typename Value>
+    const Value& Map<Key, Value>::at(const Key& key) const {
+        for (const auto& node : bucket(hash(key))) {
+            if (node.key == key) {
+                return node.value;
+            }
+        }
+
+        throw std::out_of_range("Key not found in Map");
+    }
+
     /**
      * @brief Removes a key-value pair from the Map by key.
      * @param key The key to erase.
@@ -37,19 +238,19 @@ namespace CustomCXX {
      */
     template <typename Key, typename Value>
     void Map<Key, Value>::erase(const Key& key) {
-        size_t bucket_index = hash(key);
-        auto& bucket = buckets[bucket_index];
+        if (!contains(key)) {
+            // Key not found; checked first so shared buckets are not copied for nothing
+            throw std::out_of_range("Key not found in Map");
+        }
 
-        for (auto it = bucket.begin(); it != bucket.end(); ++it) {
+        auto& nodes = mutable_bucket(hash(key));
+        for (auto it = nodes.begin(); it != nodes.end(); ++it) {
             if (it->key == key) {
-                bucket.erase(it); // Remove the node from the bucket
-                --size_;          // Decrement size
-                return;           // Exit after erasing
+                nodes.erase(it); // Remove the node from the bucket
+                --size_;         // Decrement size
+                return;          // Exit after erasing
             }
         }
-
-        // Key not found
-        throw std::out_of_range("Key not found in Map");
     }
 
     /**
@@ -85,44 +286,48 @@ namespace CustomCXX {
      * @brief Accesses or inserts a key-value pair.
      * If the key exists, returns the associated value.
      * If the key does not exist, inserts it with a default-constructed value.
+     * The returned reference is writable, so a shared bucket group is copied first.
      * @param key The key to access or insert.
      * @return A reference to the value associated with the key.
      */
     template <typename Key, typename Value>
     Value& Map<Key, Value>::operator[](const Key& key) {
-        size_t bucket_index = hash(key);
+        auto& nodes = mutable_bucket(hash(key));
 
         // Search for the key in the bucket
-        for (auto& node : buckets[bucket_index]) {
+        for (auto& node : nodes) {
             if (node.key == key) {
                 return node.value; // Key exists, return the value
             }
         }
 
         // Key does not exist, create a new node
-        buckets[bucket_index].push_back({key, Value{}});
+        nodes.push_back({key, Value{}});
         ++size_;
 
-        return buckets[bucket_index].back().value; // Return reference to the new value
+        return nodes.back().value; // Return reference to the new value
     }
 
     /**
      * @brief Rehashes the Map to use a new bucket count.
      * This redistributes all existing key-value pairs into new buckets.
-     * @param new_bucket_count The new number of buckets.
+     * @param new_bucket_count The new number of buckets; 0 is treated as 1.
      */
     template <typename Key, typename Value>
     void Map<Key, Value>::rehash(size_t new_bucket_count) {
-        std::vector<std::list<Node>> new_buckets(new_bucket_count);
+        if (new_bucket_count == 0) {
+            new_bucket_count = 1;
+        }
+        auto new_groups = make_table(new_bucket_count);
 
-        for (const auto& bucket : buckets) {
-            for (const auto& node : bucket) {
+        for (size_t i = 0; i < bucket_count; ++i) {
+            for (const auto& node : bucket(i)) {
                 size_t new_index = std::hash<Key>{}(node.key) % new_bucket_count;
-                new_buckets[new_index].push_back(node);
+                (*new_groups)[new_index / BUCKETS_PER_GROUP]->buckets[new_index % BUCKETS_PER_GROUP].push_back(node);
             }
         }
 
-        buckets = std::move(new_buckets);
+        groups = std::move(new_groups);
         bucket_count = new_bucket_count;
     }
 
@@ -139,17 +344,16 @@ namespace CustomCXX {
         }
 
         // Insert or overwrite logic
-        size_t index = hash(key);
-        auto& bucket = buckets[index];
+        auto& nodes = mutable_bucket(hash(key));
 
-        for (auto& node : bucket) {
+        for (auto& node : nodes) {
             if (node.key == key) {
                 node.value = value; // Overwrite
                 return;
             }
         }
 
-        bucket.push_back({key, value});
+        nodes.push_back({key, value});
         ++size_;
     }
 
@@ -161,12 +365,12 @@ namespace CustomCXX {
     CustomCXX::Vector<Key> Map<Key, Value>::keys() const {
         CustomCXX::Vector<Key> result;
 
-        for (const auto& bucket : buckets) {
-            for (const auto& node : bucket) {
+        for (size_t i = 0; i < bucket_count; ++i) {
+            for (const auto& node : bucket(i)) {
                 result.push_back(node.key);
             }
         }
 
         return result;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,242 @@
+#include "../include/Parallel.h"
+#include <memory>
+
+namespace CustomCXX {
+
+    namespace detail {
+        /**
+         * @brief Picks the number of elements handled per task.
+         * Aims for ~8 chunks per participating thread so stealing can even out
+         * uneven per-element cost, without going below one element per chunk.
+         * @param n Number of elements.
+         * @param concurrency Threads taking part (workers plus caller).
+         * @param grain Caller-requested chunk size, or 0 to choose automatically.
+         *        Clamped to n, so a huge grain means one chunk.
+         */
+        inline size_t chunk_size(size_t n, size_t concurrency, size_t grain) {
+            if (grain > 0) {
+                return grain < n ? grain : (n > 0 ? n : 1);
+            }
+            if (concurrency <= 1) {
+                return n > 0 ? n : 1; // Nobody to share with: one serial chunk
+            }
+            size_t target_chunks = concurrency * 8;
+            size_t size = n / target_chunks;
+            return size > 0 ? size : 1;
+        }
+
+        /**
+         * @brief Number of chunks of `chunk` elements needed to cover n.
+         * Written without n + chunk - 1, which can overflow.
+         */
+        inline size_t chunk_count(size_t n, size_t chunk) {
+            return n / chunk + (n % chunk != 0 ? 1 : 0);
+        }
+
+        /**
+         * @brief One past the last index of chunk c, clamped to n.
+         * @param c A chunk index below chunk_count(n, chunk), so c * chunk < n.
+         */
+        inline size_t chunk_end(size_t c, size_t chunk, size_t n) {
+            size_t begin = c * chunk;
+            return n - begin > chunk ? begin + chunk : n;
+        }
+
+        /**
+         * @brief Recursively halves the chunk range [lo, hi).
+         * The upper half is queued (and so stealable) while this thread keeps
+         * descending into the lower half, ending by running chunk `lo` itself.
+         */
+        template <typename Body>
+        void split_chunks(TaskGroup& group, size_t lo, size_t hi, const Body& body) {
+            while (hi - lo > 1) {
+                size_t mid = lo + (hi - lo) / 2;
+                group.run([&group, mid, hi, &body]() { split_chunks(group, mid, hi, body); });
+                hi = mid;
+            }
+            body(lo);
+        }
+
+        /**
+         * @brief Calls body(chunk) for every chunk index in [0, chunk_count).
+         * Runs inline when there is nothing to parallelize.
+         */
+        template <typename Body>
+        void for_each_chunk(ThreadPool& pool, size_t chunk_count, const Body& body) {
+            if (chunk_count == 0) {
+                return;
+            }
+            if (chunk_count == 1 || pool.worker_count() == 0) {
+                for (size_t c = 0; c < chunk_count; ++c) {
+                    body(c);
+                }
+                return;
+            }
+            TaskGroup group(pool);
+            split_chunks(group, 0, chunk_count, body);
+            group.wait();
+        }
+    } // namespace detail
+
+    /**
+     * @brief Applies f to every element of vec in parallel.
+     * @param pool The pool to run on.
+     * @param vec The Vector whose elements are passed to f by reference.
+     * @param f Callable taking T&. It must be safe to call concurrently.
+     * @param grain Elements per task, or 0 to choose automatically.
+     */
+    template <typename T, typename F>
+    void parallel_for_each(ThreadPool& pool, Vector<T>& vec, F f, size_t grain) {
+        size_t n = vec.size();
+        size_t chunk = detail::chunk_size(n, pool.concurrency(), grain);
+        T* data = vec.begin();
+        detail::for_each_chunk(pool, detail::chunk_count(n, chunk), [&](size_t c) {
+            size_t end = detail::chunk_end(c, chunk, n);
+            for (size_t i = c * chunk; i < end; ++i) {
+                f(data[i]);
+            }
+        });
+    }
+
+    template <typename T, typename F>
+    void parallel_for_each(Vector<T>& vec, F f, size_t grain) {
+        parallel_for_each(ThreadPool::instance(), vec, std::move(f), grain);
+    }
+
+    /**
+     * @brief Builds a new Vector holding f(x) for every x of input, in order.
+     * @param pool The pool to run on.
+     * @param input The source Vector.
+     * @param f Callable taking const T&. It must be safe to call concurrently.
+     * @param grain Elements per task, or 0 to choose automatically.
+     * @return A Vector of the same size as input.
+     */
+    template <typename T, typename F, typename R>
+    Vector<R> parallel_transform(ThreadPool& pool, const Vector<T>& input, F f, size_t grain) {
+        size_t n = input.size();
+        Vector<R> result(n);
+        if (n == 0) {
+            return result;
+        }
+        size_t chunk = detail::chunk_size(n, pool.concurrency(), grain);
+        const T* src = &input[0];
+        R* dst = result.begin();
+        detail::for_each_chunk(pool, detail::chunk_count(n, chunk), [&](size_t c) {
+            size_t end = detail::chunk_end(c, chunk, n);
+            for (size_t i = c * chunk; i < end; ++i) {
+                dst[i] = f(src[i]);
+            }
+        });
+        return result;
+    }
+
+    template <typename T, typename F, typename R>
+    Vector<R> parallel_transform(const Vector<T>& input, F f, size_t grain) {
+        return parallel_transform<T, F, R>(ThreadPool::instance(), input, std::move(f), grain);
+    }
+
+    /**
+     * @brief Folds input with op, starting from init.
+     * Each chunk is folded locally and the partial results are combined left to
+     * right, so the result is deterministic for any associative op.
+     * @param pool The pool to run on.
+     * @param input The source Vector.
+     * @param init The initial value.
+     * @param op Associative binary callable.
+     * @param grain Elements per task, or 0 to choose automatically.
+     * @return init combined with every element.
+     */
+    template <typename T, typename BinaryOp>
+    T parallel_reduce(ThreadPool& pool, const Vector<T>& input, T init, BinaryOp op, size_t grain) {
+        size_t n = input.size();
+        if (n == 0) {
+            return init;
+        }
+        size_t chunk = detail::chunk_size(n, pool.concurrency(), grain);
+        size_t chunk_count = detail::chunk_count(n, chunk);
+        Vector<T> partials(chunk_count);
+        const T* src = &input[0];
+        T* out = partials.begin();
+        detail::for_each_chunk(pool, chunk_count, [&](size_t c) {
+            size_t begin = c * chunk;
+            size_t end = detail::chunk_end(c, chunk, n);
+            T acc = src[begin];
+            for (size_t i = begin + 1; i < end; ++i) {
+                acc = op(acc, src[i]);
+            }
+            out[c] = std::move(acc);
+        });
+
+        T result = std::move(init);
+        for (size_t c = 0; c < chunk_count; ++c) {
+            result = op(result, out[c]);
+        }
+        return result;
+    }
+
+    template <typename T, typename BinaryOp>
+    T parallel_reduce(const Vector<T>& input, T init, BinaryOp op, size_t grain) {
+        return parallel_reduce(ThreadPool::instance(), input, std::move(init), std::move(op), grain);
+    }
+
+    /**
+     * @brief Copies the elements matching pred into a new Vector, keeping their order.
+     * Two passes: chunks first mark and count their matches, then - after a
+     * prefix sum over the counts - copy them to their final offsets.
+     * @param pool The pool to run on.
+     * @param input The source Vector.
+     * @param pred Callable taking const T&, evaluated exactly once per element.
+     * @param grain Elements per task, or 0 to choose automatically.
+     * @return The matching elements in their original order.
+     */
+    template <typename T, typename Predicate>
+    Vector<T> parallel_filter(ThreadPool& pool, const Vector<T>& input, Predicate pred, size_t grain) {
+        size_t n = input.size();
+        if (n == 0) {
+            return Vector<T>();
+        }
+        size_t chunk = detail::chunk_size(n, pool.concurrency(), grain);
+        size_t chunk_count = detail::chunk_count(n, chunk);
+        const T* src = &input[0];
+        std::unique_ptr<unsigned char[]> keep(new unsigned char[n]);
+        Vector<size_t> offsets(chunk_count);
+        size_t* offset = offsets.begin();
+
+        detail::for_each_chunk(pool, chunk_count, [&](size_t c) {
+            size_t end = detail::chunk_end(c, chunk, n);
+            size_t count = 0;
+            for (size_t i = c * chunk; i < end; ++i) {
+                keep[i] = pred(src[i]) ? 1 : 0;
+                count += keep[i];
+            }
+            offset[c] = count;
+        });
+
+        // Exclusive prefix sum turns per-chunk counts into output offsets
+        size_t total = 0;
+        for (size_t c = 0; c < chunk_count; ++c) {
+            size_t count = offset[c];
+            offset[c] = total;
+            total += count;
+        }
+
+        Vector<T> result(total);
+        T* dst = result.begin();
+        detail::for_each_chunk(pool, chunk_count, [&](size_t c) {
+            size_t end = detail::chunk_end(c, chunk, n);
+            size_t out = offset[c];
+            for (size_t i = c * chunk; i < end; ++i) {
+                if (keep[i]) {
+                    dst[out++] = src[i];
+                }
+            }
+        });
+        return result;
+    }
+
+    template <typename T, typename Predicate>
+    Vector<T> parallel_filter(const Vector<T>& input, Predicate pred, size_t grain) {
+        return parallel_filter(ThreadPool::instance(), input, std::move(pred), grain);
+    }
+
+} // namespace CustomCXX
@@ -0,0 +1,494 @@
+#include "../include/PriorityQueue.h"
+
+namespace CustomCXX {
+
+    /**
+     * @brief Constructs an empty PriorityQueue.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    PriorityQueue<T, Compare, Arity>::PriorityQueue() : _heap(), _comp() {}
+
+    /**
+     * @brief Constructs an empty PriorityQueue with a comparator instance.
+     * @param comp Orders elements; top() is the greatest.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    PriorityQueue<T, Compare, Arity>::PriorityQueue(const Compare& comp) : _heap(), _comp(comp) {}
+
+    /**
+     * @brief Builds a PriorityQueue from existing elements in O(n).
+     * Pass the Vector with std::move to reuse its storage without copying.
+     * @param values The elements to queue.
+     * @param comp Orders elements; top() is the greatest.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    PriorityQueue<T, Compare, Arity>::PriorityQueue(Vector<T> values, const Compare& comp)
+        : _heap(std::move(values)), _comp(comp) {
+        heapify();
+    }
+
+    /**
+     * @brief Constructs a PriorityQueue from an initializer list.
+     * @param list The elements to queue.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    PriorityQueue<T, Compare, Arity>::PriorityQueue(std::initializer_list<T> list) : _heap(list), _comp() {
+        heapify();
+    }
+
+    /**
+     * @brief Sifts the whole array from the last parent up to the root.
+     * Most nodes are near the leaves and move at most a level or two, which
+     * makes this O(n) rather than the O(n log n) of n pushes.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::heapify() {
+        size_t n = _heap.size();
+        if (n < 2) {
+            return;
+        }
+        T* data = _heap.begin();
+        for (size_t i = (n - 2) / Arity + 1; i-- > 0;) {
+            sift_down(data, i);
+        }
+    }
+
+    /**
+     * @brief Moves an element up until its parent is not smaller.
+     * The element is held aside and parents are shifted down into the hole,
+     * so each level costs one move instead of a swap.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::sift_up(T* data, size_t index) {
+        T value = std::move(data[index]);
+        while (index > 0) {
+            size_t parent = (index - 1) / Arity;
+            if (!_comp(data[parent], value)) {
+                break;
+            }
+            data[index] = std::move(data[parent]);
+            index = parent;
+        }
+        data[index] = std::move(value);
+    }
+
+    /**
+     * @brief Offset of the greatest of N adjacent children.
+     * Compares as a tournament: the halves are decided independently, so the
+     * comparisons of one level of the heap form a chain of log2(N) rather
+     * than N - 1 dependent selects. Ties go to the earlier child.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    template <size_t N>
+    size_t PriorityQueue<T, Compare, Arity>::best_child(const T* children) const {
+        if constexpr (N == 1) {
+            return 0;
+        } else {
+            size_t left = best_child<N / 2>(children);
+            size_t right = N / 2 + best_child<N - N / 2>(children + N / 2);
+            // Arithmetic select: compilers keep it free of a 50/50 branch
+            return left + static_cast<size_t>(_comp(children[left], children[right])) * (right - left);
+        }
+    }
+
+    /**
+     * @brief Moves an element down until no child is greater.
+     * Every level picks the greatest of up to Arity adjacent children.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::sift_down(T* data, size_t index) {
+        size_t n = _heap.size();
+        T value = std::move(data[index]);
+        while (true) {
+            size_t first = Arity * index + 1;
+            if (first >= n) {
+                break;
+            }
+            size_t best = first;
+            if (first + Arity <= n) {
+                best += best_child<Arity>(data + first);
+            } else {
+                for (size_t c = first + 1; c < n; ++c) {
+                    best = _comp(data[best], data[c]) ? c : best;
+                }
+            }
+            if (!_comp(value, data[best])) {
+                break;
+            }
+            data[index] = std::move(data[best]);
+            index = best;
+        }
+        data[index] = std::move(value);
+    }
+
+    /**
+     * @brief Returns the greatest element.
+     * @throws std::underflow_error If the queue is empty.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    const T& PriorityQueue<T, Compare, Arity>::top() const {
+        if (_heap.size() == 0) {
+            throw std::underflow_error("PriorityQueue is empty");
+        }
+        return _heap[0];
+    }
+
+    /**
+     * @brief Adds an element in O(log n).
+     * @param value The value to add.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::push(const T& value) {
+        _heap.push_back(value);
+        sift_up(_heap.begin(), _heap.size() - 1);
+    }
+
+    template <typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::push(T&& value) {
+        _heap.push_back(std::move(value));
+        sift_up(_heap.begin(), _heap.size() - 1);
+    }
+
+    /**
+     * @brief Constructs an element from the given arguments and adds it.
+     * @param args Arguments forwarded to T's constructor.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    template <typename... Args>
+    void PriorityQueue<T, Compare, Arity>::emplace(Args&&... args) {
+        _heap.emplace_back(std::forward<Args>(args)...);
+        sift_up(_heap.begin(), _heap.size() - 1);
+    }
+
+    /**
+     * @brief Removes the greatest element in O(Arity * log_Arity n).
+     * @throws std::underflow_error If the queue is empty.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::pop() {
+        if (_heap.size() == 0) {
+            throw std::underflow_error("PriorityQueue is empty");
+        }
+        T* data = _heap.begin();
+        size_t last = _heap.size() - 1;
+        if (last > 0) {
+            data[0] = std::move(data[last]);
+        }
+        _heap.pop_back();
+        if (last > 1) {
+            sift_down(data, 0);
+        }
+    }
+
+    /**
+     * @brief Removes the greatest element and returns it.
+     * Unlike top() followed by pop(), the element is moved out, not copied.
+     * @return The former top element.
+     * @throws std::underflow_error If the queue is empty.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    T PriorityQueue<T, Compare, Arity>::pop_top() {
+        if (_heap.size() == 0) {
+            throw std::underflow_error("PriorityQueue is empty");
+        }
+        T result = std::move(_heap.begin()[0]);
+        pop();
+        return result;
+    }
+
+    template <typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::clear() {
+        _heap.clear();
+    }
+
+    template <typename T, typename Compare, size_t Arity>
+    void PriorityQueue<T, Compare, Arity>::reserve(size_t new_capacity) {
+        _heap.reserve(new_capacity);
+    }
+
+    template <typename T, typename Compare, size_t Arity>
+    size_t PriorityQueue<T, Compare, Arity>::size() const {
+        return _heap.size();
+    }
+
+    template <typename T, typename Compare, size_t Arity>
+    bool PriorityQueue<T, Compare, Arity>::empty() const {
+        return _heap.size() == 0;
+    }
+
+    // IndexedPriorityQueue
+
+    /**
+     * @brief Constructs an empty IndexedPriorityQueue.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    IndexedPriorityQueue<T, Compare, Arity>::IndexedPriorityQueue()
+        : _heap(), _slot(), _generation(), _free(), _comp() {}
+
+    /**
+     * @brief Constructs an empty IndexedPriorityQueue with a comparator instance.
+     * @param comp Orders values; top() is the greatest.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    IndexedPriorityQueue<T, Compare, Arity>::IndexedPriorityQueue(const Compare& comp)
+        : _heap(), _slot(), _generation(), _free(), _comp(comp) {}
+
+    /**
+     * @brief Moves an entry up, updating the slot of every entry it passes.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<T, Compare, Arity>::sift_up(Entry* data, size_t* slots, size_t index) {
+        Entry entry = std::move(data[index]);
+        while (index > 0) {
+            size_t parent = (index - 1) / Arity;
+            if (!_comp(data[parent].value, entry.value)) {
+                break;
+            }
+            data[index] = std::move(data[parent]);
+            slots[data[index].id] = index;
+            index = parent;
+        }
+        data[index] = std::move(entry);
+        slots[data[index].id] = index;
+    }
+
+    /**
+     * @brief Moves an entry down, updating the slot of every entry it passes.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<T, Compare, Arity>::sift_down(Entry* data, size_t* slots, size_t index) {
+        size_t n = _heap.size();
+        Entry entry = std::move(data[index]);
+        while (true) {
+            size_t first = Arity * index + 1;
+            if (first >= n) {
+                break;
+            }
+            size_t end = first + Arity < n ? first + Arity : n;
+            size_t best = first;
+            for (size_t c = first + 1; c < end; ++c) {
+                if (_comp(data[best].value, data[c].value)) {
+                    best = c;
+                }
+            }
+            if (!_comp(entry.value, data[best].value)) {
+                break;
+            }
+            data[index] = std::move(data[best]);
+            slots[data[index].id] = index;
+            index = best;
+        }
+        data[index] = std::move(entry);
+        slots[data[index].id] = index;
+    }
+
+    /**
+     * @brief Removes the entry at a heap index and frees its id.
+     * The last entry fills the gap and is sifted whichever way it belongs.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<T, Compare, Arity>::remove_at(size_t index) {
+        Entry* data = _heap.begin();
+        size_t* slots = _slot.begin();
+        size_t last = _heap.size() - 1;
+
+        free_id(data[index].id);
+
+        if (index != last) {
+            data[index] = std::move(data[last]);
+            _heap.pop_back();
+            if (index > 0 && _comp(data[(index - 1) / Arity].value, data[index].value)) {
+                sift_up(data, slots, index);
+            } else {
+                sift_down(data, slots, index);
+            }
+        } else {
+            _heap.pop_back();
+        }
+    }
+
+    /**
+     * @brief Marks an id free and bumps its generation, so every handle
+     *        issued for it so far stops being valid.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<T, Compare, Arity>::free_id(size_t id) {
+        _slot[id] = npos;
+        _generation[id] = (_generation[id] + 1) & ID_MASK;
+        _free.push_back(id);
+    }
+
+    /**
+     * @brief Combines an id with its current generation.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    typename IndexedPriorityQueue<T, Compare, Arity>::Handle IndexedPriorityQueue<T, Compare, Arity>::handle_of(size_t id) const {
+        return (static_cast<Handle>(_generation[id]) << ID_BITS) | id;
+    }
+
+    /**
+     * @brief Returns the heap index of a live handle.
+     * @throws std::out_of_range If the handle does not refer to a queued entry.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    size_t IndexedPriorityQueue<T, Compare, Arity>::slot_of(Handle handle) const {
+        if (!contains(handle)) {
+            throw std::out_of_range("Invalid PriorityQueue handle");
+        }
+        return _slot[handle & ID_MASK];
+    }
+
+    /**
+     * @brief Returns the greatest value.
+     * @throws std::underflow_error If the queue is empty.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    const T& IndexedPriorityQueue<T, Compare, Arity>::top() const {
+        if (_heap.size() == 0) {
+            throw std::underflow_error("PriorityQueue is empty");
+        }
+        return _heap[0].value;
+    }
+
+    /**
+     * @brief Returns the handle of the greatest value.
+     * @throws std::underflow_error If the queue is empty.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    typename IndexedPriorityQueue<T, Compare, Arity>::Handle IndexedPriorityQueue<T, Compare, Arity>::top_handle() const {
+        if (_heap.size() == 0) {
+            throw std::underflow_error("PriorityQueue is empty");
+        }
+        return handle_of(_heap[0].id);
+    }
+
+    /**
+     * @brief Returns the value of a queued entry.
+     * @throws std::out_of_range If the handle does not refer to a queued entry.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    const T& IndexedPriorityQueue<T, Compare, Arity>::get(Handle handle) const {
+        return _heap[slot_of(handle)].value;
+    }
+
+    /**
+     * @brief Reports whether a handle refers to a queued entry.
+     * False once the entry is popped or erased, even after its id is reused.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    bool IndexedPriorityQueue<T, Compare, Arity>::contains(Handle handle) const {
+        size_t id = handle & ID_MASK;
+        return id < _slot.size() && _slot[id] != npos && _generation[id] == (handle >> ID_BITS);
+    }
+
+    /**
+     * @brief Adds a value in O(log n).
+     * @param value The value to add.
+     * @return A handle for later decrease_key(), update() or erase() calls.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    typename IndexedPriorityQueue<T, Compare, Arity>::Handle IndexedPriorityQueue<T, Compare, Arity>::push(const T& value) {
+        return push(T(value));
+    }
+
+    template <typename T, typename Compare, size_t Arity>
+    typename IndexedPriorityQueue<T, Compare, Arity>::Handle IndexedPriorityQueue<T, Compare, Arity>::push(T&& value) {
+        size_t id;
+        if (_free.size() > 0) {
+            id = _free[_free.size() - 1];
+            _free.pop_back();
+        } else {
+            id = _slot.size();
+            if (id > ID_MASK) {
+                throw std::length_error("IndexedPriorityQueue has too many entries");
+            }
+            _slot.push_back(npos);
+            _generation.push_back(0);
+        }
+
+        _heap.push_back(Entry{std::move(value), id});
+        sift_up(_heap.begin(), _slot.begin(), _heap.size() - 1);
+        return handle_of(id);
+    }
+
+    /**
+     * @brief Removes the greatest value; its handle becomes invalid.
+     * @throws std::underflow_error If the queue is empty.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<T, Compare, Arity>::pop() {
+        if (_heap.size() == 0) {
+            throw std::underflow_error("PriorityQueue is empty");
+        }
+        remove_at(0);
+    }
+
+    /**
+     * @brief Gives an entry a higher (or equal) priority in O(log n).
+     * For a min-queue (std::greater) this lowers the key, as in Dijkstra or
+     * when a timer is moved earlier.
+     * @param handle The entry to change.
+     * @param value Its new value, not less than the old one under Compare.
+     * @throws std::out_of_range If the handle does not refer to a queued entry.
+     * @throws std::invalid_argument If the new value would lower the priority.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<T, Compare, Arity>::decrease_key(Handle handle, const T& value) {
+        size_t index = slot_of(handle);
+        Entry* data = _heap.begin();
+        if (_comp(value, data[index].value)) {
+            throw std::invalid_argument("decrease_key would lower the entry's priority");
+        }
+        data[index].value = value;
+        sift_up(data, _slot.begin(), index);
+    }
+
+    /**
+     * @brief Changes an entry's value in either direction in O(log n).
+     * @throws std::out_of_range If the handle does not refer to a queued entry.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<T, Compare, Arity>::update(Handle handle, const T& value) {
+        size_t index = slot_of(handle);
+        Entry* data = _heap.begin();
+        bool raised = _comp(data[index].value, value);
+        data[index].value = value;
+        if (raised) {
+            sift_up(data, _slot.begin(), index);
+        } else {
+            sift_down(data, _slot.begin(), index);
+        }
+    }
+
+    /**
+     * @brief Removes an entry in O(log n); its handle becomes invalid.
+     * @throws std::out_of_range If the handle does not refer to a queued entry.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<T, Compare, Arity>::erase(Handle handle) {
+        remove_at(slot_of(handle));
+    }
+
+    /**
+     * @brief Removes all entries; every handle becomes invalid.
+     * Ids are kept with bumped generations, so no old handle comes back.
+     */
+    template <typename T, typename Compare, size_t Arity>
+    void IndexedPriorityQueue<T, Compare, Arity>::clear() {
+        for (const Entry& entry : _heap.span()) {
+            free_id(entry.id);
+        }
+        _heap.clear();
+    }
+
+    template <typename T, typename Compare, size_t Arity>
+    size_t IndexedPriorityQueue<T, Compare, Arity>::size() const {
+        return _heap.size();
+    }
+
+    template <typename T, typename Compare, size_t Arity>
+    bool IndexedPriorityQueue<T, Compare, Arity>::empty() const {
+        return _heap.size() == 0;
+    }
+
+} // namespace CustomCXX
@@ -0,0 +1,163 @@
+#include "../include/Span.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace CustomCXX {
+
+    namespace detail {
+        /**
+         * @brief Reports an out-of-range operator[] index and aborts.
+         * Kept out of line and cold so checked loops only carry a compare
+         * and a rarely taken branch.
+         */
+        [[noreturn]] inline void bounds_failure(size_t index, size_t size) {
+            std::fprintf(stderr, "CustomCXX: index %zu out of range (size %zu)\n", index, size);
+            std::abort();
+        }
+    } // namespace detail
+
+    /**
+     * @brief Constructs an empty Span.
+     */
+    template <typename T>
+    constexpr Span<T>::Span() noexcept : _data(nullptr), _size(0) {}
+
+    /**
+     * @brief Constructs a Span over `size` elements starting at `data`.
+     */
+    template <typename T>
+    constexpr Span<T>::Span(T* data, size_t size) noexcept : _data(data), _size(size) {}
+
+    /**
+     * @brief Converts a Span<U> to a Span<T> when U* converts to T* without
+     *        slicing, i.e. adds const.
+     */
+    template <typename T>
+    template <typename U, typename>
+    constexpr Span<T>::Span(const Span<U>& other) noexcept : _data(other.data()), _size(other.size()) {}
+
+    /**
+     * @brief Accesses an element; checked only when CUSTOMCXX_ASSERT_BOUNDS is 1.
+     */
+    template <typename T>
+    constexpr T& Span<T>::operator[](size_t index) const {
+        detail::assert_index(index, _size);
+        return _data[index];
+    }
+
+    /**
+     * @brief Accesses an element with bounds checking.
+     * @throws std::out_of_range If the index is out of bounds.
+     */
+    template <typename T>
+    constexpr T& Span<T>::at(size_t index) const {
+        if (index >= _size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return _data[index];
+    }
+
+    /**
+     * @brief Returns the first element.
+     * @throws std::underflow_error If the Span is empty.
+     */
+    template <typename T>
+    constexpr T& Span<T>::front() const {
+        if (_size == 0) {
+            throw std::underflow_error("Span is empty");
+        }
+        return _data[0];
+    }
+
+    /**
+     * @brief Returns the last element.
+     * @throws std::underflow_error If the Span is empty.
+     */
+    template <typename T>
+    constexpr T& Span<T>::back() const {
+        if (_size == 0) {
+            throw std::underflow_error("Span is empty");
+        }
+        return _data[_size - 1];
+    }
+
+    template <typename T>
+    constexpr T* Span<T>::data() const noexcept {
+        return _data;
+    }
+
+    /**
+     * @brief Returns the first `count` elements.
+     * @throws std::out_of_range If count exceeds size().
+     */
+    template <typename T>
+    constexpr Span<T> Span<T>::first(size_t count) const {
+        if (count > _size) {
+            throw std::out_of_range("Span range out of bounds");
+        }
+        return Span(_data, count);
+    }
+
+    /**
+     * @brief Returns the last `count` elements.
+     * @throws std::out_of_range If count exceeds size().
+     */
+    template <typename T>
+    constexpr Span<T> Span<T>::last(size_t count) const {
+        if (count > _size) {
+            throw std::out_of_range("Span range out of bounds");
+        }
+        return Span(_data + (_size - count), count);
+    }
+
+    /**
+     * @brief Returns `count` elements starting at `offset`.
+     * @param offset Index of the first element, at most size().
+     * @param count Number of elements, or npos for all remaining ones.
+     * @throws std::out_of_range If the range does not fit in this Span.
+     */
+    template <typename T>
+    constexpr Span<T> Span<T>::subspan(size_t offset, size_t count) const {
+        if (offset > _size) {
+            throw std::out_of_range("Span range out of bounds");
+        }
+        if (count == npos) {
+            count = _size - offset;
+        } else if (count > _size - offset) {
+            throw std::out_of_range("Span range out of bounds");
+        }
+        return Span(_data + offset, count);
+    }
+
+    template <typename T>
+    constexpr size_t Span<T>::size() const noexcept {
+        return _size;
+    }
+
+    template <typename T>
+    constexpr bool Span<T>::empty() const noexcept {
+        return _size == 0;
+    }
+
+    template <typename T>
+    constexpr T* Span<T>::begin() const noexcept {
+        return _data;
+    }
+
+    template <typename T>
+    constexpr T* Span<T>::end() const noexcept {
+        return _data + _size;
+    }
+
+    template <typename T>
+    constexpr typename Span<T>::reverse_iterator Span<T>::rbegin() const noexcept {
+        return reverse_iterator(end());
+    }
+
+    template <typename T>
+    constexpr typename Span<T>::reverse_iterator Span<T>::rend() const noexcept {
+        return reverse_iterator(begin());
+    }
+
+} // namespace CustomCXX
@@ -0,0 +1,243 @@
+#include "../include/ThreadPool.h"
+
+namespace CustomCXX {
+
+    namespace detail {
+        /**
+         * @brief Identifies the pool and deque owned by the calling thread.
+         * Non-worker threads keep `pool == nullptr`.
+         */
+        struct WorkerSlot {
+            const ThreadPool* pool = nullptr;
+            size_t index = 0;
+        };
+
+        inline WorkerSlot& worker_slot() {
+            thread_local WorkerSlot slot;
+            return slot;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Starts `worker_count` background threads, each with its own deque.
+     * @param worker_count Number of workers. Zero is valid: tasks then only run
+     *        on threads that call try_run_one() or TaskGroup::wait().
+     */
+    inline ThreadPool::ThreadPool(size_t worker_count)
+        : _queued(0), _next_queue(0), _stop(false) {
+        size_t queue_count = worker_count == 0 ? 1 : worker_count;
+        _queues.reserve(queue_count);
+        for (size_t i = 0; i < queue_count; ++i) {
+            _queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        _workers.reserve(worker_count);
+        for (size_t i = 0; i < worker_count; ++i) {
+            _workers.emplace_back([this, i]() { worker_loop(i); });
+        }
+    }
+
+    /**
+     * @brief Drains the remaining tasks and joins all workers.
+     */
+    inline ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(_sleep_mutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (auto& worker : _workers) {
+            worker.join();
+        }
+        // Without workers nothing else will run what is left
+        while (try_run_one()) {}
+    }
+
+    /**
+     * @brief Returns the default number of workers: one per hardware thread,
+     * minus the caller which participates in every parallel algorithm.
+     */
+    inline size_t ThreadPool::default_worker_count() {
+        size_t hw = std::thread::hardware_concurrency();
+        return hw > 1 ? hw - 1 : 0;
+    }
+
+    /**
+     * @brief Returns the lazily constructed process-wide pool.
+     */
+    inline ThreadPool& ThreadPool::instance() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    inline size_t ThreadPool::worker_count() const {
+        return _workers.size();
+    }
+
+    inline size_t ThreadPool::concurrency() const {
+        return _workers.size() + 1;
+    }
+
+    inline long ThreadPool::current_worker() const {
+        const detail::WorkerSlot& slot = detail::worker_slot();
+        return slot.pool == this ? static_cast<long>(slot.index) : -1;
+    }
+
+    /**
+     * @brief Queues a task.
+     * Workers push onto the back of their own deque so recursive splits stay
+     * local; other threads spread their tasks round-robin over all deques.
+     * @param task The callable to run.
+     */
+    inline void ThreadPool::submit(Task task) {
+        long self = current_worker();
+        size_t index = self >= 0
+            ? static_cast<size_t>(self)
+            : _next_queue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+        {
+            std::lock_guard<std::mutex> lock(_queues[index]->mutex);
+            _queues[index]->tasks.push_back(std::move(task));
+        }
+        _queued.fetch_add(1, std::memory_order_release);
+        {
+            // Pairs with the predicate check in worker_loop so a wakeup is never lost
+            std::lock_guard<std::mutex> lock(_sleep_mutex);
+        }
+        _wake.notify_one();
+    }
+
+    /**
+     * @brief Pops the newest task from a worker's own deque.
+     */
+    inline bool ThreadPool::pop_local(size_t index, Task& task) {
+        WorkerQueue& queue = *_queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    /**
+     * @brief Takes the oldest task from some other deque.
+     * @param thief Deque to start after; victims are scanned round-robin.
+     */
+    inline bool ThreadPool::steal(size_t thief, Task& task) {
+        size_t count = _queues.size();
+        for (size_t offset = 1; offset <= count; ++offset) {
+            WorkerQueue& queue = *_queues[(thief + offset) % count];
+            std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+            if (!lock.owns_lock() || queue.tasks.empty()) {
+                continue;
+            }
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Runs one queued task on the calling thread.
+     * @return true if a task was run, false if no task could be found.
+     */
+    inline bool ThreadPool::try_run_one() {
+        if (_queued.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        Task task;
+        long self = current_worker();
+        bool found = self >= 0
+            ? pop_local(static_cast<size_t>(self), task) || steal(static_cast<size_t>(self), task)
+            : steal(_next_queue.load(std::memory_order_relaxed), task);
+        if (!found) {
+            return false;
+        }
+        _queued.fetch_sub(1, std::memory_order_relaxed);
+        task();
+        return true;
+    }
+
+    /**
+     * @brief Main loop of a worker: run local work, steal, otherwise sleep.
+     */
+    inline void ThreadPool::worker_loop(size_t index) {
+        detail::worker_slot() = {this, index};
+        while (true) {
+            if (try_run_one()) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_sleep_mutex);
+            if (_stop && _queued.load() == 0) {
+                return;
+            }
+            _wake.wait(lock, [this]() { return _stop || _queued.load() > 0; });
+            if (_stop && _queued.load() == 0) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Creates an empty group bound to a pool.
+     */
+    inline TaskGroup::TaskGroup(ThreadPool& pool) : _pool(pool), _pending(0) {}
+
+    /**
+     * @brief Waits for outstanding tasks; their exceptions are discarded here.
+     */
+    inline TaskGroup::~TaskGroup() {
+        try {
+            wait();
+        } catch (...) {
+        }
+    }
+
+    /**
+     * @brief Submits a callable as part of this group.
+     * Exceptions thrown by the callable are captured and rethrown by wait().
+     * @param f The callable to run.
+     */
+    template <typename F>
+    void TaskGroup::run(F&& f) {
+        _pending.fetch_add(1, std::memory_order_relaxed);
+        try {
+            _pool.submit([this, fn = std::forward<F>(f)]() mutable {
+                try {
+                    fn();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(_error_mutex);
+                    if (!_error) {
+                        _error = std::current_exception();
+                    }
+                }
+                _pending.fetch_sub(1, std::memory_order_acq_rel);
+            });
+        } catch (...) {
+            _pending.fetch_sub(1, std::memory_order_acq_rel); // Never queued, so wait() must not count it
+            throw;
+        }
+    }
+
+    /**
+     * @brief Runs queued tasks on the calling thread until the group is done.
+     * @throws Whatever the first failing task threw.
+     */
+    inline void TaskGroup::wait() {
+        while (_pending.load(std::memory_order_acquire) > 0) {
+            if (!_pool.try_run_one()) {
+                std::this_thread::yield();
+            }
+        }
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(_error_mutex);
+            std::swap(error, _error);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+} // namespace CustomCXX
@@ -8,7 +8,16 @@ namespace CustomCXX {
      * Initializes an empty Vector with no allocated memory.
      */
     template <typename T>
-    Vector<T>::Vector() : _data(nullptr), _capacity(0), _size(0) {}
+    Vector<T>::Vector() : _data(nullptr), _capacity(0), _size(0), _refs(nullptr) {}
+
+    /**
+     * @brief Constructs a Vector holding `initial_size` default-constructed elements.
+     * @param initial_size The number of elements to create.
+     */
+    template <typename T>
+    Vector<T>::Vector(size_t initial_size)
+        : _data(initial_size ? new T[initial_size]() : nullptr), _capacity(initial_size), _size(initial_size),
+          _refs(nullptr) {}
 
     /**
      * @brief Destructor for Vector.
@@ -16,21 +25,119 @@ namespace CustomCXX {
      */
     template <typename T>
     Vector<T>::~Vector() {
-        delete[] _data;
+        release();
+    }
+
+    /**
+     * @brief Drops this Vector's reference to its storage.
+     * Uniquely owned storage is freed; shared storage is freed by whichever
+     * owner releases it last. Leaves `_data` and `_refs` null.
+     */
+    template <typename T>
+    void Vector<T>::release() {
+        if (!_refs) {
+            delete[] _data;
+        } else if (_refs->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete[] _data;
+            delete _refs;
+        }
+        _data = nullptr;
+        _refs = nullptr;
+    }
+
+    /**
+     * @brief Makes the storage exclusive to this Vector before it is modified.
+     * The unshared case is a plain, non-atomic null check that the optimizer
+     * can keep out of loops; the reference count is only touched once shared.
+     */
+    template <typename T>
+    void Vector<T>::detach() {
+        if (_refs) {
+            detach_shared();
+        }
+    }
+
+    /**
+     * @brief Takes shared storage back, or copies it if snapshots still use it.
+     * If every snapshot is already gone the storage is simply taken back;
+     * otherwise the elements are copied and the shared block is released.
+     */
+    template <typename T>
+    void Vector<T>::detach_shared() {
+        if (_refs->load(std::memory_order_acquire) == 1) {
+            delete _refs; // Last owner: no clone needed
+            _refs = nullptr;
+            return;
+        }
+        std::unique_ptr<T[]> own_data(new T[_capacity]); // Freed if a copy throws
+        for (size_t i = 0; i < _size; ++i) {
+            own_data[i] = _data[i];
+        }
+        release();
+        _data = own_data.release();
+    }
+
+    /**
+     * @brief Returns a Vector sharing this Vector's storage, in O(1).
+     *
+     * The storage becomes immutable and reference-counted: both Vectors read
+     * the same elements, and whichever one is modified first (including a
+     * non-const operator[] or begin()) copies the elements for itself.
+     *
+     * Taking a snapshot invalidates every pointer, reference, iterator and
+     * Span previously obtained from this Vector's non-const members: they
+     * point into the now-shared storage, so writing through them would also
+     * change the snapshot. Obtain them again after the call.
+     *
+     * snapshot() updates this Vector's bookkeeping, so it must not race with
+     * other uses of this Vector. The returned Vector may be handed to another
+     * thread; the shared reference count is atomic.
+     *
+     * @return A Vector equal to this one that shares its memory.
+     */
+    template <typename T>
+    Vector<T> Vector<T>::snapshot() {
+        if (!_refs) {
+            _refs = new RefCount(1); // This Vector's own reference
+        }
+        _refs->fetch_add(1, std::memory_order_relaxed);
+
+        Vector result;
+        result._data = _data;
+        result._capacity = _capacity;
+        result._size = _size;
+        result._refs = _refs;
+        return result;
+    }
+
+    /**
+     * @brief Reports whether the storage is currently shared with a snapshot.
+     */
+    template <typename T>
+    bool Vector<T>::is_shared() const {
+        return _refs && _refs->load(std::memory_order_acquire) > 1;
     }
 
     /**
      * @brief Resizes the internal storage of the Vector.
+     * Storage still shared with a snapshot is copied straight into the new
+     * allocation, so it is not detached first and copied twice.
      * @param new_capacity The new capacity for the Vector.
      */
     template <typename T>
     void Vector<T>::resize(size_t new_capacity) {
-        T* new_data = new T[new_capacity];
-        for (size_t i = 0; i < _size; ++i) {
-            new_data[i] = std::move(_data[i]);
+        std::unique_ptr<T[]> new_data(new T[new_capacity]); // Freed if a copy throws
+        if (is_shared()) {
+            for (size_t i = 0; i < _size; ++i) {
+                new_data[i] = _data[i];
+            }
+        } else {
+            for (size_t i = 0; i < _size; ++i) {
+                new_data[i] = std::move(_data[i]);
+            }
         }
-        delete[] _data;
-        _data = new_data;
+        release();
+        _data = new_data.release();
         _capacity = new_capacity; // Ensure capacity is updated
     }
 
@@ -41,11 +148,44 @@ namespace CustomCXX {
     template <typename T>
     void Vector<T>::push_back(const T& value) {
         if (_size == _capacity) {
-            resize(_capacity == 0 ? 1 : _capacity * 2);
+            T copy = value; // value may live in the storage resize() frees
+            resize(_capacity == 0 ? 1 : _capacity * 2); // Also detaches
+            _data[_size++] = std::move(copy);
+            return;
         }
+        detach();
         _data[_size++] = value;
     }
 
+    /**
+     * @brief Moves an element onto the end of the Vector.
+     * @param value The value to move from.
+     */
+    template <typename T>
+    void Vector<T>::push_back(T&& value) {
+        if (_size == _capacity) {
+            T moved = std::move(value); // value may live in the storage resize() frees
+            resize(_capacity == 0 ? 1 : _capacity * 2); // Also detaches
+            _data[_size++] = std::move(moved);
+            return;
+        }
+        detach();
+        _data[_size++] = std::move(value);
+    }
+
+    /**
+     * @brief Constructs an element from the given arguments at the end of the Vector.
+     * Storage slots are always constructed, so the new element is move-assigned into place.
+     * @param args Arguments forwarded to T's constructor.
+     * @return A reference to the new element.
+     */
+    template <typename T>
+    template <typename... Args>
+    T& Vector<T>::emplace_back(Args&&... args) {
+        push_back(T(std::forward<Args>(args)...));
+        return _data[_size - 1];
+    }
+
     /**
      * @brief Removes the last element from the Vector.
      * @throws std::underflow_error If the Vector is empty.
@@ -55,31 +195,61 @@ namespace CustomCXX {
         if (_size == 0) {
             throw std::underflow_error("Vector is empty");
         }
+        detach();
         --_size;
     }
 
     /**
      * @brief Accesses an element at the given index (non-const).
+     * Unchecked unless CUSTOMCXX_ASSERT_BOUNDS is 1; use at() for a throwing check.
+     * Shared storage is detached first, so a write never reaches a snapshot.
+     * Hot loops should take span() once: the span indexes raw memory, while
+     * the copy-on-write check here keeps the compiler from vectorizing.
+     * @param index The index of the element, below size().
+     * @return Reference to the element at the index.
+     */
+    template <typename T>
+    T& Vector<T>::operator[](size_t index) {
+        detail::assert_index(index, _size);
+        detach();
+        return _data[index];
+    }
+
+    /**
+     * @brief Accesses an element at the given index (const).
+     * Unchecked unless CUSTOMCXX_ASSERT_BOUNDS is 1; use at() for a throwing check.
+     * @param index The index of the element, below size().
+     * @return Const reference to the element at the index.
+     */
+    template <typename T>
+    const T& Vector<T>::operator[](size_t index) const {
+        detail::assert_index(index, _size);
+        return _data[index];
+    }
+
+    /**
+     * @brief Accesses an element at the given index with bounds checking (non-const).
      * @param index The index of the element.
      * @return Reference to the element at the index.
      * @throws std::out_of_range If the index is out of bounds.
      */
     template <typename T>
-    T& Vector<T>::operator[](size_t index) {
+    T& Vector<T>::at(size_t index) {
         if (index >= _size) {
             throw std::out_of_range("Index out of range");
         }
+        detach();
         return _data[index];
     }
 
     /**
-     * @brief Accesses an element at the given index (const).
+     * @brief Accesses an element at the given index with bounds checking (const).
      * @param index The index of the element.
      * @return Const reference to the element at the index.
      * @throws std::out_of_range If the index is out of bounds.
      */
     template <typename T>
-    const T& Vector<T>::operator[](size_t index) const {
+    const T& Vector<T>::at(size_t index) const {
         if (index >= _size) {
             throw std::out_of_range("Index out of range");
         }
@@ -92,7 +262,7 @@ namespace CustomCXX {
      */
     template <typename T>
     Vector<T>::Vector(std::initializer_list<T> list)
-        : _data(new T[list.size()]), _capacity(list.size()), _size(list.size()) {
+        : _data(new T[list.size()]), _capacity(list.size()), _size(list.size()), _refs(nullptr) {
         size_t i = 0;
         for (const auto& elem : list) {
             _data[i++] = elem;
@@ -123,6 +293,7 @@ namespace CustomCXX {
      */
     template <typename T>
     T* Vector<T>::begin() {
+        detach();
         return _data;
     }
 
@@ -132,14 +303,69 @@ namespace CustomCXX {
      */
     template <typename T>
     T* Vector<T>::end() {
+        detach();
+        return _data + _size;
+    }
+
+    /**
+     * @brief Returns a read-only iterator to the beginning of the Vector.
+     * Never copies shared storage.
+     * @return Pointer to the first element.
+     */
+    template <typename T>
+    const T* Vector<T>::begin() const {
+        return _data;
+    }
+
+    /**
+     * @brief Returns a read-only iterator to the end of the Vector.
+     * @return Pointer to one past the last element.
+     */
+    template <typename T>
+    const T* Vector<T>::end() const {
+        return _data + _size;
+    }
+
+    template <typename T>
+    const T* Vector<T>::cbegin() const {
+        return _data;
+    }
+
+    template <typename T>
+    const T* Vector<T>::cend() const {
         return _data + _size;
     }
 
+    /**
+     * @brief Returns a writable view of all elements.
+     * Loops over the span index raw memory: no copy-on-write check and no
+     * exception path per element, so the compiler can vectorize them.
+     * @return A Span valid until the Vector reallocates.
+     */
+    template <typename T>
+    Span<T> Vector<T>::span() {
+        detach();
+        return Span<T>(_data, _size);
+    }
+
+    /**
+     * @brief Returns a read-only view of all elements.
+     * @return A Span valid until the Vector reallocates or is written.
+     */
+    template <typename T>
+    Span<const T> Vector<T>::span() const {
+        return Span<const T>(_data, _size);
+    }
+
     /**
      * @brief Clears all elements from the Vector.
      */
     template <typename T>
     void Vector<T>::clear() {
+        if (_refs) {
+            release(); // No need to copy elements that are about to go
+            _capacity = 0;
+        }
         _size = 0; // Reset the size to zero
     }
 
@@ -156,7 +382,9 @@ namespace CustomCXX {
         }
 
         if (_size == _capacity) {
-            resize(_capacity == 0 ? 1 : _capacity * 2); // Ensure capacity
+            resize(_capacity == 0 ? 1 : _capacity * 2); // Ensure capacity; also detaches
+        } else {
+            detach();
         }
 
         // Shift elements to the right
@@ -178,6 +406,7 @@ namespace CustomCXX {
         if (index >= _size) {
             throw std::out_of_range("Index out of range");
         }
+        detach();
 
         // Shift elements to the left
         for (size_t i = index; i < _size - 1; ++i) {
@@ -197,7 +426,9 @@ namespace CustomCXX {
      */
     template <typename T>
     Vector<T>::Vector(Vector&& other) noexcept
-        : _data(other._data), _capacity(other._capacity), _size(other._size) {
+        : _data(other._data), _capacity(other._capacity), _size(other._size),
+          _refs(other._refs) {
+        other._refs = nullptr;
         other._data = nullptr;
         other._capacity = 0;
         other._size = 0;
@@ -215,12 +446,14 @@ namespace CustomCXX {
     template <typename T>
     Vector<T>& Vector<T>::operator=(Vector&& other) noexcept {
         if (this != &other) {
-            delete[] _data; // Clean up existing resources
+            release(); // Clean up existing resources
 
             _data = other._data;
             _capacity = other._capacity;
             _size = other._size;
+            _refs = other._refs;
 
+            other._refs = nullptr;
             other._data = nullptr;
             other._capacity = 0;
             other._size = 0;
@@ -236,7 +469,7 @@ namespace CustomCXX {
      */
     template <typename T>
     Vector<T>::Vector(const Vector& other)
-        :_data(new T[other._capacity]), _capacity(other._capacity), _size(other._size) {
+        :_data(new T[other._capacity]), _capacity(other._capacity), _size(other._size), _refs(nullptr) {
         for (size_t i = 0; i < _size; ++i) {
             _data[i] = other._data[i];
         }
@@ -252,7 +485,7 @@ namespace CustomCXX {
     template <typename T>
     Vector<T>& Vector<T>::operator=(const Vector& other) {
         if (this != &other) { // Avoid self-assignment
-            delete[] _data;
+            release();
 
             _data = new T[other._capacity];
             _capacity = other._capacity;
@@ -287,23 +520,31 @@ namespace CustomCXX {
     }
 
     /**
-     * @brief Returns a reverse iterator pointing to the last element of the Vector.
-     * 
-     * @return Pointer to the last element or `_data` if the Vector is empty.
+     * @brief Returns a reverse iterator to the last element of the Vector.
+     * Incrementing it walks towards the front; it equals rend() when empty.
      */
     template <typename T>
-    T* Vector<T>::rbegin() {
-        return _size > 0 ? (_data + _size - 1) : _data; // Pointer to the last element or Return _data if empty
+    typename Vector<T>::reverse_iterator Vector<T>::rbegin() {
+        return reverse_iterator(end());
     }
 
     /**
-     * @brief Returns a reverse iterator pointing before the first element of the Vector.
-     * 
-     * @return Pointer to one position before `_data`.
+     * @brief Returns a reverse iterator past the first element of the Vector.
+     * It wraps begin(), so no pointer before the storage is ever formed.
      */
     template <typename T>
-    T* Vector<T>::rend() {
-        return _data - 1; // Pointer to one before the first element
+    typename Vector<T>::reverse_iterator Vector<T>::rend() {
+        return reverse_iterator(begin());
+    }
+
+    template <typename T>
+    typename Vector<T>::const_reverse_iterator Vector<T>::rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    template <typename T>
+    typename Vector<T>::const_reverse_iterator Vector<T>::rend() const {
+        return const_reverse_iterator(begin());
     }
 
 /**
@@ -387,6 +628,7 @@ namespace CustomCXX {
         if (_size == 0 || _size == 1) {
             return; // No need to sort
         }
+        detach();
         merge_sort(0, _size - 1, std::less<T>());
     }
 
@@ -401,6 +643,7 @@ namespace CustomCXX {
         if (_size == 0 || _size == 1) {
             return; // No need to sort
         }
+        detach();
         merge_sort(0, _size - 1, comp);
     }
 
@@ -419,6 +662,9 @@ namespace CustomCXX {
         if (_size != other._size) {
             return false; // Sizes must match
         }
+        if (_data == other._data) {
+            return true; // Same (shared) storage
+        }
         for (size_t i = 0; i < _size; ++i) {
             if (_data[i] != other._data[i]) {
                 return false; // Elements must match
@@ -0,0 +1,180 @@
+#include "BitVector.h"
+#include <gtest/gtest.h>
+#include <string>
+
+TEST(BitVectorTest, Initialization) {
+    CustomCXX::BitVector bits;
+    EXPECT_EQ(bits.size(), 0);
+    EXPECT_EQ(bits.capacity(), 0);
+    EXPECT_TRUE(bits.none());
+
+    CustomCXX::BitVector ones(130, true);
+    EXPECT_EQ(ones.size(), 130);
+    EXPECT_EQ(ones.count(), 130);
+    EXPECT_TRUE(ones.all());
+
+    CustomCXX::BitVector list = {true, false, true, true};
+    EXPECT_EQ(list.count(), 3);
+    EXPECT_FALSE(list[1]);
+}
+
+TEST(BitVectorTest, ProxyReference) {
+    CustomCXX::BitVector bits(10);
+    bits[3] = true;
+    bits[4] = bits[3];
+    bits[5].flip();
+    EXPECT_TRUE(bits[3]);
+    EXPECT_TRUE(bits[4]);
+    EXPECT_TRUE(bits[5]);
+    EXPECT_EQ(bits.count(), 3);
+
+    bits[3] = false;
+    EXPECT_FALSE(bits.test(3));
+
+    // Ensure out-of-range access throws an exception
+    try {
+        bits[10] = true;
+        EXPECT_TRUE(false); // Should not reach here
+    } catch (const std::out_of_range& e) {
+        EXPECT_EQ(std::string(e.what()), "Index out of range");
+    }
+}
+
+TEST(BitVectorTest, PushBackPopBackAndResize) {
+    CustomCXX::BitVector bits;
+    for (int i = 0; i < 200; ++i) {
+        bits.push_back(i % 3 == 0);
+    }
+    EXPECT_EQ(bits.size(), 200);
+    EXPECT_EQ(bits.count(), 67);
+    EXPECT_GE(bits.capacity(), 200);
+
+    bits.pop_back(); // 199 % 3 != 0
+    bits.pop_back(); // 198 % 3 == 0
+    EXPECT_EQ(bits.count(), 66);
+
+    // Shrinking must not leave stale bits behind when growing again
+    bits.resize(10);
+    EXPECT_EQ(bits.count(), 4);
+    bits.resize(100);
+    EXPECT_EQ(bits.count(), 4);
+    bits.resize(150, true);
+    EXPECT_EQ(bits.count(), 54);
+    EXPECT_TRUE(bits[149]);
+
+    CustomCXX::BitVector empty_bits;
+    try {
+        empty_bits.pop_back();
+        EXPECT_TRUE(false); // Should not reach here
+    } catch (const std::underflow_error& e) {
+        EXPECT_EQ(std::string(e.what()), "BitVector is empty");
+    }
+}
+
+TEST(BitVectorTest, WholeVectorOperations) {
+    CustomCXX::BitVector bits(70);
+    bits.set();
+    EXPECT_EQ(bits.count(), 70);
+    bits.flip();
+    EXPECT_EQ(bits.count(), 0);
+    bits.set(69);
+    bits.flip();
+    EXPECT_EQ(bits.count(), 69); // Tail bits stay clear after flip
+    bits.reset();
+    EXPECT_TRUE(bits.none());
+}
+
+TEST(BitVectorTest, FindFirstAndNext) {
+    CustomCXX::BitVector bits(1000);
+    EXPECT_EQ(bits.find_first(), CustomCXX::BitVector::npos);
+
+    const size_t positions[] = {0, 63, 64, 500, 999};
+    for (size_t p : positions) {
+        bits.set(p);
+    }
+
+    size_t i = 0;
+    for (size_t p = bits.find_first(); p != CustomCXX::BitVector::npos; p = bits.find_next(p)) {
+        ASSERT_LT(i, 5);
+        EXPECT_EQ(p, positions[i++]);
+    }
+    EXPECT_EQ(i, 5);
+    EXPECT_EQ(bits.find_next(999), CustomCXX::BitVector::npos);
+}
+
+TEST(BitVectorTest, BulkBitwiseOperations) {
+    CustomCXX::BitVector a(300), b(300);
+    for (size_t i = 0; i < 300; ++i) {
+        a.set(i, i % 2 == 0);
+        b.set(i, i % 3 == 0);
+    }
+
+    EXPECT_EQ((a & b).count(), 50);  // Multiples of 6
+    EXPECT_EQ((a | b).count(), 200);
+    EXPECT_EQ((a ^ b).count(), 150);
+
+    CustomCXX::BitVector c = a;
+    c.and_not(b);
+    EXPECT_EQ(c.count(), 100);
+    EXPECT_TRUE(c[2]);
+    EXPECT_FALSE(c[6]);
+
+    CustomCXX::BitVector other_size(10);
+    try {
+        a &= other_size;
+        EXPECT_TRUE(false); // Should not reach here
+    } catch (const std::invalid_argument& e) {
+        EXPECT_EQ(std::string(e.what()), "BitVector sizes differ");
+    }
+}
+
+TEST(BitVectorTest, RankAndSelect) {
+    CustomCXX::BitVector bits(5000);
+    for (size_t i = 0; i < 5000; i += 7) {
+        bits.set(i);
+    }
+
+    // Same answers with and without the index
+    for (int pass = 0; pass < 2; ++pass) {
+        EXPECT_EQ(bits.rank(0), 0);
+        EXPECT_EQ(bits.rank(1), 1);
+        EXPECT_EQ(bits.rank(7), 1);
+        EXPECT_EQ(bits.rank(8), 2);
+        EXPECT_EQ(bits.rank(5000), bits.count());
+        for (size_t k = 0; k < bits.count(); k += 37) {
+            EXPECT_EQ(bits.select(k), k * 7);
+            EXPECT_EQ(bits.rank(bits.select(k)), k);
+        }
+        EXPECT_EQ(bits.select(bits.count()), CustomCXX::BitVector::npos);
+        bits.build_rank_index();
+    }
+
+    // Modifying invalidates the index
+    bits.set(1);
+    EXPECT_EQ(bits.rank(7), 2);
+    EXPECT_EQ(bits.select(1), 1);
+    EXPECT_THROW(bits.rank(5001), std::out_of_range);
+}
+
+TEST(BitVectorTest, CopyMoveAndEquality) {
+    CustomCXX::BitVector bits = {true, false, true};
+    CustomCXX::BitVector copy(bits);
+    copy[1] = true;
+    EXPECT_FALSE(bits[1]);
+    EXPECT_FALSE(copy == bits);
+
+    CustomCXX::BitVector moved = std::move(copy);
+    EXPECT_EQ(moved.count(), 3);
+    EXPECT_EQ(copy.size(), 0);
+
+    copy = bits;
+    EXPECT_TRUE(copy == bits);
+    copy = copy;
+    EXPECT_TRUE(copy == bits);
+}
+
+// Run all tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,100 @@
+#include "FixedMap.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+
+namespace {
+
+enum class Opcode { Nop, Load, Store, Add, Sub, Jump, Halt };
+
+constexpr CustomCXX::FixedMap<Opcode, std::string_view, 7> opcode_names = {
+    {Opcode::Nop, "nop"},   {Opcode::Load, "load"}, {Opcode::Store, "store"}, {Opcode::Add, "add"},
+    {Opcode::Sub, "sub"},   {Opcode::Jump, "jump"}, {Opcode::Halt, "halt"},
+};
+
+constexpr CustomCXX::FixedMap<std::string_view, int, 5> word_lengths = {
+    {"one", 3}, {"three", 5}, {"four", 4}, {"eleven", 6}, {"", 0},
+};
+
+int add_one(int x) { return x + 1; }
+int negate(int x) { return -x; }
+
+} // namespace
+
+TEST(FixedMapTest, CompileTimeLookup) {
+    static_assert(opcode_names.size() == 7, "table is built at compile time");
+    static_assert(opcode_names.at(Opcode::Store) == "store", "lookups work in constant expressions");
+    static_assert(word_lengths.at("eleven") == 6, "string_view keys hash at compile time");
+    static_assert(!word_lengths.contains("two"), "missing keys are detected at compile time");
+
+    EXPECT_EQ(opcode_names.at(Opcode::Halt), "halt");
+    EXPECT_EQ(word_lengths.at(""), 0);
+}
+
+TEST(FixedMapTest, EveryKeyFound) {
+    const Opcode all[] = {Opcode::Nop, Opcode::Load, Opcode::Store, Opcode::Add,
+                          Opcode::Sub, Opcode::Jump, Opcode::Halt};
+    const char* names[] = {"nop", "load", "store", "add", "sub", "jump", "halt"};
+    for (size_t i = 0; i < 7; ++i) {
+        ASSERT_TRUE(opcode_names.contains(all[i]));
+        EXPECT_EQ(opcode_names.at(all[i]), names[i]);
+    }
+}
+
+TEST(FixedMapTest, MissingKey) {
+    constexpr CustomCXX::FixedMap<int, int, 4> map = {{1, 10}, {2, 20}};
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.find(3), nullptr);
+    EXPECT_EQ(map.value_or(3, -1), -1);
+    EXPECT_EQ(map.value_or(2, -1), 20);
+
+    // Key{} must not be found just because empty slots hold it
+    EXPECT_FALSE(map.contains(0));
+
+    try {
+        map.at(42);
+        EXPECT_TRUE(false); // Should not reach here
+    } catch (const std::out_of_range& e) {
+        EXPECT_EQ(std::string(e.what()), "Key not found in FixedMap");
+    }
+}
+
+TEST(FixedMapTest, FunctionPointerValues) {
+    using Handler = int (*)(int);
+    static constexpr CustomCXX::FixedMap<char, Handler, 2> handlers = {{'+', &add_one}, {'-', &negate}};
+    EXPECT_EQ(handlers.at('+')(1), 2);
+    EXPECT_EQ(handlers.at('-')(1), -1);
+}
+
+TEST(FixedMapTest, LargerTableHasNoCollisions) {
+    // Built at run time here, but the same constructor runs at compile time
+    CustomCXX::FixedMap<int, int, 100> map = {
+        {0, 0},   {1, 1},   {2, 2},   {3, 3},   {4, 4},   {5, 5},   {6, 6},   {7, 7},   {8, 8},   {9, 9},
+        {10, 10}, {11, 11}, {12, 12}, {13, 13}, {14, 14}, {15, 15}, {16, 16}, {17, 17}, {18, 18}, {19, 19},
+        {20, 20}, {21, 21}, {22, 22}, {23, 23}, {24, 24}, {25, 25}, {26, 26}, {27, 27}, {28, 28}, {29, 29},
+        {30, 30}, {31, 31}, {32, 32}, {33, 33}, {34, 34}, {35, 35}, {36, 36}, {37, 37}, {38, 38}, {39, 39},
+        {40, 40}, {41, 41}, {42, 42}, {43, 43}, {44, 44}, {45, 45}, {46, 46}, {47, 47}, {48, 48}, {49, 49},
+        {50, 50}, {51, 51}, {52, 52}, {53, 53}, {54, 54}, {55, 55}, {56, 56}, {57, 57}, {58, 58}, {59, 59},
+        {60, 60}, {61, 61}, {62, 62}, {63, 63}, {64, 64}, {65, 65}, {66, 66}, {67, 67}, {68, 68}, {69, 69},
+        {70, 70}, {71, 71}, {72, 72}, {73, 73}, {74, 74}, {75, 75}, {76, 76}, {77, 77}, {78, 78}, {79, 79},
+        {80, 80}, {81, 81}, {82, 82}, {83, 83}, {84, 84}, {85, 85}, {86, 86}, {87, 87}, {88, 88}, {89, 89},
+        {90, 90}, {91, 91}, {92, 92}, {93, 93}, {94, 94}, {95, 95}, {96, 96}, {97, 97}, {98, 98}, {99, 99},
+    };
+    EXPECT_EQ(map.size(), 100);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(map.at(i), i);
+    }
+    EXPECT_FALSE(map.contains(100));
+    EXPECT_EQ(map.keys().size(), 100);
+}
+
+TEST(FixedMapTest, InvalidConstruction) {
+    EXPECT_THROW((CustomCXX::FixedMap<int, int, 2>{{1, 1}, {1, 2}}), std::invalid_argument);
+    EXPECT_THROW((CustomCXX::FixedMap<int, int, 1>{{1, 1}, {2, 2}}), std::length_error);
+}
+
+// Run all tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,112 @@
+#include "FixedVector.h"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+
+constexpr CustomCXX::FixedVector<int, 8> make_squares() {
+    CustomCXX::FixedVector<int, 8> vec;
+    for (int i = 0; i < 5; ++i) {
+        vec.push_back(i * i);
+    }
+    vec.erase(0);
+    vec.insert(0, -1);
+    return vec;
+}
+
+} // namespace
+
+TEST(FixedVectorTest, ConstexprConstruction) {
+    static constexpr CustomCXX::FixedVector<int, 4> vec = {1, 2, 3};
+    static_assert(vec.size() == 3, "size is known at compile time");
+    static_assert(vec[2] == 3, "elements are known at compile time");
+    static_assert(vec.capacity() == 4, "capacity is N");
+
+    static constexpr auto squares = make_squares();
+    static_assert(squares.size() == 5, "push_back/insert/erase run at compile time");
+    static_assert(squares[0] == -1 && squares[4] == 16, "values are known at compile time");
+
+    EXPECT_EQ(vec.front(), 1);
+    EXPECT_EQ(vec.back(), 3);
+}
+
+TEST(FixedVectorTest, PushBackAndPopBack) {
+    CustomCXX::FixedVector<std::string, 2> vec;
+    EXPECT_TRUE(vec.empty());
+
+    vec.push_back("a");
+    vec.push_back("b");
+    EXPECT_TRUE(vec.full());
+    EXPECT_EQ(vec[1], "b");
+
+    // Capacity check
+    try {
+        vec.push_back("c");
+        EXPECT_TRUE(false); // Should not reach here
+    } catch (const std::length_error& e) {
+        EXPECT_EQ(std::string(e.what()), "FixedVector capacity exceeded");
+    }
+
+    vec.pop_back();
+    vec.pop_back();
+    EXPECT_EQ(vec.size(), 0);
+
+    // Underflow check
+    try {
+        vec.pop_back();
+        EXPECT_TRUE(false); // Should not reach here
+    } catch (const std::underflow_error& e) {
+        EXPECT_EQ(std::string(e.what()), "FixedVector is empty");
+    }
+}
+
+TEST(FixedVectorTest, SubscriptOutOfRange) {
+    CustomCXX::FixedVector<int, 4> vec = {1, 2};
+    try {
+        (void)vec.at(2); // Within capacity but past size
+        EXPECT_TRUE(false); // Should not reach here
+    } catch (const std::out_of_range& e) {
+        EXPECT_EQ(std::string(e.what()), "Index out of range");
+    }
+#if CUSTOMCXX_ASSERT_BOUNDS
+    EXPECT_DEATH(vec[2], "index 2 out of range");
+#endif
+}
+
+TEST(FixedVectorTest, Span) {
+    static constexpr CustomCXX::FixedVector<int, 8> vec = {1, 2, 3, 4, 5};
+    constexpr CustomCXX::View<int> middle = vec.span().subspan(1, 3);
+    static_assert(middle.size() == 3 && middle[0] == 2 && middle.back() == 4, "spans work at compile time");
+
+    CustomCXX::FixedVector<int, 8> copy = vec;
+    for (int& x : copy.span().last(2)) {
+        x = 0;
+    }
+    EXPECT_EQ(copy, (CustomCXX::FixedVector<int, 8>{1, 2, 3, 0, 0}));
+}
+
+TEST(FixedVectorTest, InitializerListTooLong) {
+    EXPECT_THROW((CustomCXX::FixedVector<int, 2>{1, 2, 3}), std::length_error);
+}
+
+TEST(FixedVectorTest, InsertEraseAndIterators) {
+    CustomCXX::FixedVector<int, 6> vec = {1, 2, 4, 5};
+    vec.insert(2, 3);
+    vec.erase(0);
+
+    int expected = 2;
+    for (auto it = vec.begin(); it != vec.end(); ++it) {
+        EXPECT_EQ(*it, expected++);
+    }
+    EXPECT_EQ(vec, (CustomCXX::FixedVector<int, 6>{2, 3, 4, 5}));
+
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.begin(), vec.end());
+}
+
+// Run all tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -202,6 +202,23 @@ TEST(ListTest, CopyAssignmentCreatesIndependentListAndDestroysSafely) {
         "");
 }
 
+TEST(ListTest, NodeEraseAndMoveToFront) {
+    CustomCXX::List<int> list = {1, 2, 3, 4};
+    auto third = list.begin()->next->next;
+    list.move_to_front(third);
+    EXPECT_EQ(list, CustomCXX::List<int>({3, 1, 2, 4}));
+
+    list.move_to_front(list.rbegin());
+    EXPECT_EQ(list, CustomCXX::List<int>({4, 3, 1, 2}));
+    EXPECT_EQ(list.back(), 2);
+
+    list.erase_node(list.rbegin());
+    list.erase_node(list.begin());
+    EXPECT_EQ(list, CustomCXX::List<int>({3, 1}));
+    EXPECT_EQ(list.rbegin()->prev, list.begin());
+    EXPECT_EQ(list.size(), 2);
+}
+
 // Run all tests
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
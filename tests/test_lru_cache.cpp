@@ -0,0 +1,215 @@
+#include "LruCache.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using CustomCXX::EvictionPolicy;
+
+TEST(LruCacheTest, GetPutAndOverwrite) {
+    CustomCXX::LruCache<int, std::string> cache(3);
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.get(1), nullptr);
+
+    EXPECT_TRUE(cache.put(1, "one"));
+    EXPECT_TRUE(cache.put(2, "two"));
+    ASSERT_NE(cache.get(1), nullptr);
+    EXPECT_EQ(*cache.get(1), "one");
+
+    cache.put(1, "uno");
+    EXPECT_EQ(*cache.peek(1), "uno");
+    EXPECT_EQ(cache.size(), 2);
+
+    *cache.get(2) = "dos";
+    EXPECT_EQ(*cache.peek(2), "dos");
+
+    // Grows its buckets well past the initial count
+    CustomCXX::LruCache<int, int> large(1000);
+    for (int i = 0; i < 1000; ++i) {
+        large.put(i, i * 2);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_NE(large.peek(i), nullptr);
+        EXPECT_EQ(*large.peek(i), i * 2);
+    }
+}
+
+TEST(LruCacheTest, EvictsLeastRecentlyUsed) {
+    CustomCXX::LruCache<int, int> cache(3);
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+
+    cache.get(1);   // 2 is now the least recently used
+    cache.put(4, 40);
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_TRUE(cache.contains(1));
+
+    EXPECT_TRUE(cache.touch(3)); // 1 is now the least recently used
+    EXPECT_FALSE(cache.touch(2));
+    cache.put(5, 50);
+    EXPECT_FALSE(cache.contains(1));
+    EXPECT_EQ(cache.size(), 3);
+
+    // peek() does not refresh an entry
+    cache.peek(4);
+    cache.put(6, 60);
+    EXPECT_FALSE(cache.contains(4));
+}
+
+TEST(LruCacheTest, EraseAndClear) {
+    CustomCXX::LruCache<std::string, int> cache(4);
+    cache.put("a", 1);
+    cache.put("b", 2);
+    cache.put("c", 3);
+
+    EXPECT_TRUE(cache.erase("b"));
+    EXPECT_FALSE(cache.erase("b"));
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_FALSE(cache.contains("b"));
+
+    cache.clear();
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.weight(), 0);
+    cache.put("d", 4);
+    EXPECT_EQ(*cache.get("d"), 4);
+
+    using IntCache = CustomCXX::LruCache<int, int>;
+    EXPECT_THROW(IntCache(0), std::invalid_argument);
+}
+
+TEST(LruCacheTest, EvictionCallback) {
+    CustomCXX::LruCache<int, std::string> cache(2);
+    std::vector<int> evicted_keys;
+    std::vector<std::string> evicted_values;
+    cache.set_eviction_callback([&](const int& key, std::string& value) {
+        evicted_keys.push_back(key);
+        evicted_values.push_back(std::move(value));
+    });
+
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(1, "uno");   // Overwrite: not an eviction
+    cache.put(3, "three"); // Evicts 2
+    cache.erase(1);        // Explicit erase: not an eviction
+
+    ASSERT_EQ(evicted_keys.size(), 1);
+    EXPECT_EQ(evicted_keys[0], 2);
+    EXPECT_EQ(evicted_values[0], "two");
+}
+
+TEST(LruCacheTest, WeightBounded) {
+    CustomCXX::LruCache<int, std::string> cache(10, [](const int&, const std::string& value) { return value.size(); });
+    cache.put(1, "aaaa");
+    cache.put(2, "bbbb");
+    EXPECT_EQ(cache.weight(), 8);
+
+    cache.put(3, "ccc"); // 11 > 10: evicts 1
+    EXPECT_FALSE(cache.contains(1));
+    EXPECT_EQ(cache.weight(), 7);
+
+    cache.put(2, "bbbbbbbb"); // Re-weighed on overwrite: 11, evicts 3
+    EXPECT_EQ(cache.weight(), 8);
+    EXPECT_FALSE(cache.contains(3));
+
+    // An entry heavier than the whole budget is refused and drops the old value
+    EXPECT_FALSE(cache.put(2, std::string(11, 'x')));
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_EQ(cache.weight(), 0);
+}
+
+TEST(LruCacheTest, ClockGivesSecondChance) {
+    CustomCXX::LruCache<int, int> cache(3, EvictionPolicy::Clock);
+    EXPECT_EQ(cache.policy(), EvictionPolicy::Clock);
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+
+    cache.get(1);      // Referenced: survives the next sweep
+    cache.put(4, 40);  // Hand passes 1, evicts 2
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_FALSE(cache.contains(2));
+
+    cache.put(5, 50);  // The hand now rests on 3, which is unreferenced
+    EXPECT_FALSE(cache.contains(3));
+    EXPECT_EQ(cache.size(), 3);
+
+    // Erasing the entry under the hand keeps the sweep consistent
+    for (int i = 0; i < 100; ++i) {
+        cache.put(i, i);
+        if (i % 3 == 0) {
+            cache.erase(i - 1);
+        }
+        cache.get(i / 2);
+        EXPECT_LE(cache.size(), 3);
+    }
+}
+
+TEST(LruCacheTest, MoveTransfersEntries) {
+    CustomCXX::LruCache<int, int> cache(2);
+    cache.put(1, 1);
+    CustomCXX::LruCache<int, int> moved(std::move(cache));
+    EXPECT_TRUE(moved.contains(1));
+    EXPECT_TRUE(cache.empty());
+
+    cache.put(2, 2); // Moved-from caches stay usable
+    EXPECT_EQ(*cache.get(2), 2);
+
+    cache = std::move(moved);
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_FALSE(cache.contains(2));
+}
+
+TEST(LruCacheTest, ShardedConcurrentUse) {
+    for (EvictionPolicy policy : {EvictionPolicy::LRU, EvictionPolicy::Clock}) {
+        CustomCXX::ShardedLruCache<int, int> cache(256, 8, policy);
+        EXPECT_EQ(cache.shard_count(), 8);
+        EXPECT_EQ(cache.capacity(), 256);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&cache, t]() {
+                for (int i = 0; i < 5000; ++i) {
+                    int key = (i * 7 + t) % 512;
+                    if (auto value = cache.get(key)) {
+                        EXPECT_EQ(*value, key * 3);
+                    } else {
+                        cache.put(key, key * 3);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_LE(cache.size(), cache.capacity());
+        cache.put(1000, 1);
+        EXPECT_TRUE(cache.contains(1000));
+        EXPECT_TRUE(cache.erase(1000));
+        cache.clear();
+        EXPECT_EQ(cache.size(), 0);
+    }
+}
+
+TEST(LruCacheTest, ShardedTouchAndMovePut) {
+    for (EvictionPolicy policy : {EvictionPolicy::LRU, EvictionPolicy::Clock}) {
+        CustomCXX::ShardedLruCache<int, std::string> cache(2, 1, policy); // One shard: exact eviction order
+        std::string long_text(100, 'x');
+        EXPECT_TRUE(cache.put(1, std::move(long_text)));
+        EXPECT_TRUE(cache.put(2, "two"));
+
+        EXPECT_TRUE(cache.touch(1)); // Protects 1 from the next eviction
+        EXPECT_FALSE(cache.touch(3));
+        cache.put(3, "three");
+        EXPECT_TRUE(cache.contains(1));
+        EXPECT_FALSE(cache.contains(2));
+        EXPECT_EQ(cache.get(1), std::string(100, 'x'));
+    }
+}
+
+// Run all tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -113,6 +113,110 @@ TEST(MapTest, ZeroBucketConstructorStillUsable) {
         "");
 }
 
+TEST(MapTest, TestAt) {
+    CustomCXX::Map<int, std::string> map;
+    map[1] = "one";
+
+    const auto& const_map = map;
+    EXPECT_EQ(const_map.at(1), "one");
+    try {
+        const_map.at(2);
+        EXPECT_TRUE(false); // Should not reach here
+    } catch (const std::out_of_range& e) {
+        EXPECT_EQ(std::string(e.what()), "Key not found in Map");
+    }
+    EXPECT_EQ(map.size(), 1); // at() never inserts
+}
+
+TEST(MapTest, SnapshotClonesOnWrite) {
+    CustomCXX::Map<int, std::string> map;
+    for (int i = 0; i < 200; ++i) {
+        map.insert_or_assign(i, "v" + std::to_string(i));
+    }
+
+    const CustomCXX::Map<int, std::string> snap = map.snapshot();
+    EXPECT_TRUE(map.is_shared());
+    EXPECT_EQ(snap.size(), 200);
+    const auto& const_map = map;
+    EXPECT_EQ(&snap.at(5), &const_map.at(5)); // Same node
+
+    map[5] = "changed";
+    map.insert_or_assign(1000, "new");
+    map.erase(7);
+
+    EXPECT_EQ(snap.at(5), "v5");
+    EXPECT_FALSE(snap.contains(1000));
+    EXPECT_TRUE(snap.contains(7));
+    EXPECT_EQ(snap.size(), 200);
+
+    EXPECT_EQ(map.at(5), "changed");
+    EXPECT_EQ(map.size(), 200);
+
+    // Groups that were not written are still shared
+    EXPECT_TRUE(map.is_shared());
+}
+
+TEST(MapTest, SnapshotSurvivesRehashAndDestruction) {
+    auto* map = new CustomCXX::Map<int, int>(4);
+    for (int i = 0; i < 3; ++i) {
+        map->insert_or_assign(i, i * 10);
+    }
+    CustomCXX::Map<int, int> snap = map->snapshot();
+    for (int i = 3; i < 100; ++i) {
+        map->insert_or_assign(i, i * 10); // Forces rehashes
+    }
+    EXPECT_FALSE(map->is_shared());
+    delete map;
+
+    EXPECT_EQ(snap.size(), 3);
+    EXPECT_EQ(snap.at(2), 20);
+    EXPECT_FALSE(snap.contains(3));
+    EXPECT_FALSE(snap.is_shared());
+}
+
+TEST(MapTest, SnapshotInvalidatesEarlierReferences) {
+    CustomCXX::Map<int, int> map;
+    int& before = map[1];
+    before = 10;
+    const CustomCXX::Map<int, int> snap = map.snapshot();
+
+    // A reference taken before the snapshot now aliases the shared bucket
+    EXPECT_EQ(&before, &snap.at(1));
+
+    // Looking the key up again clones the bucket group, so writes stay private
+    int& after = map[1];
+    EXPECT_NE(&after, &before);
+    after = 42;
+    EXPECT_EQ(snap.at(1), 10);
+    EXPECT_EQ(map.at(1), 42);
+}
+
+TEST(MapTest, CopiesAndMovesStayIndependent) {
+    CustomCXX::Map<int, std::string> map;
+    map[1] = "one";
+
+    CustomCXX::Map<int, std::string> copy(map);
+    copy[1] = "uno";
+    EXPECT_EQ(map.at(1), "one");
+    EXPECT_FALSE(map.is_shared());
+
+    CustomCXX::Map<int, std::string> moved(std::move(copy));
+    EXPECT_EQ(moved.at(1), "uno");
+
+    // The moved-from Map is empty but still usable
+    EXPECT_EQ(copy.size(), 0);
+    copy[2] = "two";
+    EXPECT_EQ(copy.at(2), "two");
+    CustomCXX::Map<int, std::string> other(std::move(map));
+    EXPECT_FALSE(map.contains(2)); // Moved-from Maps do not see each other's writes
+    EXPECT_FALSE(map.is_shared());
+    EXPECT_EQ(map.keys().size(), 0);
+    CustomCXX::Map<int, std::string> copy_of_empty(map);
+    copy_of_empty.insert_or_assign(3, "three");
+    EXPECT_EQ(copy_of_empty.at(3), "three");
+    EXPECT_FALSE(map.contains(3));
+}
+
 // Run all tests
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
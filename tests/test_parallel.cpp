@@ -0,0 +1,178 @@
+#include "Parallel.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+TEST(ThreadPoolTest, SubmittedTasksRun) {
+    CustomCXX::ThreadPool pool(3);
+    EXPECT_EQ(pool.worker_count(), 3);
+    EXPECT_EQ(pool.concurrency(), 4);
+
+    std::atomic<int> counter{0};
+    CustomCXX::TaskGroup group(pool);
+    for (int i = 0; i < 100; ++i) {
+        group.run([&counter]() { ++counter; });
+    }
+    group.wait();
+    EXPECT_EQ(counter.load(), 100);
+}
+
+TEST(ThreadPoolTest, ZeroWorkersRunOnCaller) {
+    CustomCXX::ThreadPool pool(0);
+    std::atomic<int> counter{0};
+    CustomCXX::TaskGroup group(pool);
+    for (int i = 0; i < 10; ++i) {
+        group.run([&counter]() { ++counter; });
+    }
+    group.wait(); // The caller is the only thread that can run them
+    EXPECT_EQ(counter.load(), 10);
+}
+
+TEST(ThreadPoolTest, NestedTasksComplete) {
+    CustomCXX::ThreadPool pool(2);
+    std::atomic<int> counter{0};
+    CustomCXX::TaskGroup group(pool);
+    for (int i = 0; i < 8; ++i) {
+        group.run([&]() {
+            for (int j = 0; j < 8; ++j) {
+                group.run([&counter]() { ++counter; });
+            }
+        });
+    }
+    group.wait();
+    EXPECT_EQ(counter.load(), 64);
+}
+
+TEST(ThreadPoolTest, WaitRethrowsTaskException) {
+    CustomCXX::ThreadPool pool(2);
+    CustomCXX::TaskGroup group(pool);
+    group.run([]() { throw std::runtime_error("task failed"); });
+    group.run([]() {});
+    try {
+        group.wait();
+        EXPECT_TRUE(false); // Should not reach here
+    } catch (const std::runtime_error& e) {
+        EXPECT_EQ(std::string(e.what()), "task failed");
+    }
+}
+
+// A task whose copy throws, so TaskGroup::run fails before anything is queued
+struct ThrowingCopyTask {
+    ThrowingCopyTask() = default;
+    ThrowingCopyTask(const ThrowingCopyTask&) { throw std::bad_alloc(); }
+    void operator()() const {}
+};
+
+TEST(ThreadPoolTest, FailedRunDoesNotBlockWait) {
+    CustomCXX::ThreadPool pool(2);
+    CustomCXX::TaskGroup group(pool);
+    ThrowingCopyTask task;
+    EXPECT_THROW(group.run(task), std::bad_alloc);
+    group.wait(); // Would block forever if the failed run were still counted
+}
+
+TEST(ParallelTest, ForEachVisitsEveryElement) {
+    CustomCXX::ThreadPool pool(3);
+    CustomCXX::Vector<int> vec(10000);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>(i);
+    }
+
+    CustomCXX::parallel_for_each(pool, vec, [](int& x) { x *= 2; });
+    for (size_t i = 0; i < vec.size(); ++i) {
+        EXPECT_EQ(vec[i], static_cast<int>(2 * i));
+    }
+
+    // Explicit grain, including one that does not divide the size
+    CustomCXX::parallel_for_each(pool, vec, [](int& x) { x += 1; }, 333);
+    EXPECT_EQ(vec[0], 1);
+    EXPECT_EQ(vec[9999], 2 * 9999 + 1);
+}
+
+TEST(ParallelTest, HugeGrainRunsOneChunk) {
+    CustomCXX::ThreadPool pool(3);
+    CustomCXX::Vector<int> vec = {1, 2, 3, 4, 5};
+    const size_t huge = static_cast<size_t>(-1);
+
+    CustomCXX::parallel_for_each(pool, vec, [](int& x) { x *= 10; }, huge);
+    EXPECT_EQ(vec, (CustomCXX::Vector<int>{10, 20, 30, 40, 50}));
+    EXPECT_EQ(CustomCXX::parallel_reduce(pool, vec, 1, std::plus<int>(), huge), 151);
+    auto doubled = CustomCXX::parallel_transform(pool, vec, [](const int& x) { return x * 2; }, huge);
+    EXPECT_EQ(doubled[4], 100);
+    auto big = CustomCXX::parallel_filter(pool, vec, [](const int& x) { return x > 25; }, huge);
+    EXPECT_EQ(big, (CustomCXX::Vector<int>{30, 40, 50}));
+}
+
+TEST(ParallelTest, ForEachEmptyVector) {
+    CustomCXX::Vector<int> vec;
+    CustomCXX::parallel_for_each(vec, [](int& x) { x = 1; });
+    EXPECT_EQ(vec.size(), 0);
+}
+
+TEST(ParallelTest, TransformChangesType) {
+    CustomCXX::ThreadPool pool(2);
+    CustomCXX::Vector<int> vec = {1, 2, 3, 4, 5};
+    auto result = CustomCXX::parallel_transform(pool, vec, [](const int& x) { return std::to_string(x * x); }, 1);
+    EXPECT_EQ(result.size(), 5);
+    EXPECT_EQ(result[0], "1");
+    EXPECT_EQ(result[4], "25");
+}
+
+TEST(ParallelTest, ReduceMatchesSerialSum) {
+    CustomCXX::ThreadPool pool(3);
+    CustomCXX::Vector<long long> vec;
+    long long expected = 0;
+    for (long long i = 0; i < 100001; ++i) {
+        vec.push_back(i);
+        expected += i;
+    }
+    EXPECT_EQ(CustomCXX::parallel_reduce(pool, vec, 0LL, std::plus<long long>()), expected);
+    EXPECT_EQ(CustomCXX::parallel_reduce(pool, vec, 10LL, std::plus<long long>(), 7), expected + 10);
+
+    CustomCXX::Vector<long long> empty_vec;
+    EXPECT_EQ(CustomCXX::parallel_reduce(pool, empty_vec, 42LL, std::plus<long long>()), 42);
+}
+
+TEST(ParallelTest, ReduceKeepsOrderForNonCommutativeOp) {
+    CustomCXX::ThreadPool pool(3);
+    CustomCXX::Vector<std::string> vec = {"a", "b", "c", "d", "e", "f", "g"};
+    auto concat = [](const std::string& a, const std::string& b) { return a + b; };
+    EXPECT_EQ(CustomCXX::parallel_reduce(pool, vec, std::string(">"), concat, 2), ">abcdefg");
+}
+
+TEST(ParallelTest, FilterIsStable) {
+    CustomCXX::ThreadPool pool(3);
+    CustomCXX::Vector<int> vec;
+    for (int i = 0; i < 50000; ++i) {
+        vec.push_back(i);
+    }
+
+    auto evens = CustomCXX::parallel_filter(pool, vec, [](const int& x) { return x % 2 == 0; });
+    EXPECT_EQ(evens.size(), 25000);
+    for (size_t i = 0; i < evens.size(); ++i) {
+        EXPECT_EQ(evens[i], static_cast<int>(2 * i));
+    }
+
+    auto none = CustomCXX::parallel_filter(pool, vec, [](const int&) { return false; });
+    EXPECT_EQ(none.size(), 0);
+}
+
+TEST(ParallelTest, ExceptionPropagatesToCaller) {
+    CustomCXX::ThreadPool pool(2);
+    CustomCXX::Vector<int> vec(1000);
+    try {
+        CustomCXX::parallel_for_each(pool, vec, [](int&) { throw std::logic_error("bad element"); }, 10);
+        EXPECT_TRUE(false); // Should not reach here
+    } catch (const std::logic_error& e) {
+        EXPECT_EQ(std::string(e.what()), "bad element");
+    }
+}
+
+// Run all tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
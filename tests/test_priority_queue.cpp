@@ -0,0 +1,167 @@
+#include "PriorityQueue.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(PriorityQueueTest, PushPopOrder) {
+    CustomCXX::PriorityQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_THROW(queue.top(), std::underflow_error);
+    EXPECT_THROW(queue.pop(), std::underflow_error);
+
+    for (int value : {5, 1, 9, 3, 7, 9, 0}) {
+        queue.push(value);
+    }
+    EXPECT_EQ(queue.size(), 7);
+    EXPECT_EQ(queue.top(), 9);
+
+    std::vector<int> drained;
+    while (!queue.empty()) {
+        drained.push_back(queue.pop_top());
+    }
+    EXPECT_EQ(drained, (std::vector<int>{9, 9, 7, 5, 3, 1, 0}));
+}
+
+TEST(PriorityQueueTest, MinQueueAndEmplace) {
+    CustomCXX::PriorityQueue<std::string, std::greater<std::string>> queue;
+    queue.emplace(3, 'c');
+    queue.emplace("aa");
+    queue.push(std::string("b"));
+    EXPECT_EQ(queue.top(), "aa");
+    queue.pop();
+    EXPECT_EQ(queue.top(), "b");
+    queue.pop();
+    EXPECT_EQ(queue.pop_top(), "ccc");
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(PriorityQueueTest, HeapifyFromVector) {
+    CustomCXX::Vector<int> values;
+    std::vector<int> expected;
+    std::mt19937 rng(7);
+    for (int i = 0; i < 1000; ++i) {
+        int value = static_cast<int>(rng() % 500);
+        values.push_back(value);
+        expected.push_back(value);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    CustomCXX::PriorityQueue<int, std::greater<int>> queue(std::move(values));
+    EXPECT_EQ(queue.size(), 1000);
+    for (int value : expected) {
+        ASSERT_EQ(queue.pop_top(), value);
+    }
+
+    CustomCXX::PriorityQueue<int> from_list = {4, 8, 2};
+    EXPECT_EQ(from_list.top(), 8);
+}
+
+TEST(PriorityQueueTest, ArityVariantsAgree) {
+    CustomCXX::PriorityQueue<int, std::less<int>, 2> binary;
+    CustomCXX::PriorityQueue<int, std::less<int>, 8> octal;
+    std::mt19937 rng(11);
+    for (int round = 0; round < 2000; ++round) {
+        if (rng() % 3 == 0 && !binary.empty()) {
+            ASSERT_EQ(binary.top(), octal.top());
+            binary.pop();
+            octal.pop();
+        } else {
+            int value = static_cast<int>(rng() % 100);
+            binary.push(value);
+            octal.push(value);
+        }
+    }
+    EXPECT_EQ(binary.size(), octal.size());
+}
+
+TEST(PriorityQueueTest, IndexedDecreaseKeyAndErase) {
+    // Timers: smallest deadline first
+    CustomCXX::IndexedPriorityQueue<int, std::greater<int>> timers;
+    auto a = timers.push(50);
+    auto b = timers.push(20);
+    auto c = timers.push(30);
+    EXPECT_EQ(timers.top(), 20);
+    EXPECT_EQ(timers.top_handle(), b);
+
+    timers.decrease_key(a, 10); // Rescheduled earlier
+    EXPECT_EQ(timers.top_handle(), a);
+    EXPECT_EQ(timers.get(a), 10);
+    EXPECT_THROW(timers.decrease_key(c, 40), std::invalid_argument);
+
+    timers.update(a, 60);       // Postponed
+    EXPECT_EQ(timers.top_handle(), b);
+
+    timers.erase(b);            // Cancelled
+    EXPECT_FALSE(timers.contains(b));
+    EXPECT_THROW(timers.erase(b), std::out_of_range);
+    EXPECT_EQ(timers.top(), 30);
+
+    timers.pop();
+    EXPECT_FALSE(timers.contains(c));
+    EXPECT_EQ(timers.top_handle(), a);
+    EXPECT_EQ(timers.size(), 1);
+
+    // Popped and erased handles stay invalid after their ids are reused
+    auto d = timers.push(1);
+    EXPECT_NE(d, b);
+    EXPECT_NE(d, c);
+    EXPECT_FALSE(timers.contains(b));
+    EXPECT_FALSE(timers.contains(c));
+    EXPECT_THROW(timers.get(b), std::out_of_range);
+    EXPECT_THROW(timers.erase(c), std::out_of_range);
+    EXPECT_TRUE(timers.contains(d));
+    EXPECT_EQ(timers.top_handle(), d);
+    EXPECT_EQ(timers.size(), 2);
+
+    // So do handles from before a clear()
+    timers.clear();
+    auto e = timers.push(3);
+    EXPECT_FALSE(timers.contains(a));
+    EXPECT_FALSE(timers.contains(d));
+    EXPECT_THROW(timers.decrease_key(d, 0), std::out_of_range);
+    EXPECT_EQ(timers.get(e), 3);
+}
+
+TEST(PriorityQueueTest, IndexedMatchesReference) {
+    CustomCXX::IndexedPriorityQueue<int> queue;
+    std::vector<std::pair<size_t, int>> live; // handle, value
+    std::mt19937 rng(3);
+
+    for (int round = 0; round < 3000; ++round) {
+        unsigned op = rng() % 4;
+        if (op == 0 || live.empty()) {
+            int value = static_cast<int>(rng() % 1000);
+            live.push_back({queue.push(value), value});
+        } else if (op == 1) {
+            size_t i = rng() % live.size();
+            int value = static_cast<int>(rng() % 1000);
+            queue.update(live[i].first, value);
+            live[i].second = value;
+        } else if (op == 2) {
+            size_t i = rng() % live.size();
+            queue.erase(live[i].first);
+            live.erase(live.begin() + i);
+        } else {
+            auto best = std::max_element(live.begin(), live.end(),
+                                         [](const auto& x, const auto& y) { return x.second < y.second; });
+            ASSERT_EQ(queue.top(), best->second);
+            auto top = std::find_if(live.begin(), live.end(),
+                                    [&](const auto& entry) { return entry.first == queue.top_handle(); });
+            ASSERT_NE(top, live.end());
+            queue.pop();
+            live.erase(top);
+        }
+        ASSERT_EQ(queue.size(), live.size());
+        for (const auto& entry : live) {
+            ASSERT_EQ(queue.get(entry.first), entry.second);
+        }
+    }
+}
+
+// Run all tests
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,6 +1,7 @@
 #include "Vector.h"
 #include <gtest/gtest.h>
 #include <iostream>
+#include <string>
 
 TEST(VectorTest, Initialization) {
     CustomCXX::Vector<int> vec;
@@ -60,13 +61,18 @@ TEST(VectorTest, TestSubscriptOperator) {
     vec[0] = 10;
     EXPECT_EQ(vec[0], 10);
     
-    // Ensure out-of-range access throws an exception
+    // Ensure out-of-range access through at() throws an exception
     try {
-        int x = vec[10]; // Should throw
+        int x = vec.at(10); // Should throw
         EXPECT_TRUE(false);   // Should not reach here
     } catch (const std::out_of_range& e) {
         EXPECT_EQ(std::string(e.what()), "Index out of range");
     }
+
+    // operator[] only asserts, and only when bounds assertions are enabled
+#if CUSTOMCXX_ASSERT_BOUNDS
+    EXPECT_DEATH(vec[10], "index 10 out of range");
+#endif
 }
 
 TEST(VectorTest, TestIterators) {
@@ -86,9 +92,9 @@ TEST(VectorTest, TestClear) {
     EXPECT_EQ(vec.size(), 0);
     EXPECT_GT(vec.capacity(), 0); // Capacity should remain unchanged
 
-    // Ensure accessing elements throws an error
+    // Ensure checked access throws an error
     try {
-        int x = vec[0];
+        int x = vec.at(0);
         EXPECT_TRUE(false); // Should not reach here
     } catch (const std::out_of_range& e) {
         EXPECT_EQ(std::string(e.what()),"Index out of range");
@@ -160,7 +166,7 @@ TEST(VectorTest, TestMoveSemantics) {
     // Ensure vec1 is empty
     EXPECT_EQ(vec1.size(), 0);
     try {
-        int x = vec1[0];
+        int x = vec1.at(0);
         EXPECT_TRUE(false); // Should not reach here
     } catch (const std::out_of_range& e) {
         EXPECT_EQ(std::string(e.what()), "Index out of range");
@@ -234,19 +240,20 @@ TEST(VectorTest, TestReverseIterator) {
     CustomCXX::Vector<int> vec = {1, 2, 3};
 
     int expected = 3;
-    for (auto it = vec.rbegin(); it != vec.rend(); --it) {
+    for (auto it = vec.rbegin(); it != vec.rend(); ++it) {
         EXPECT_EQ(*it, expected--);
     }
+    EXPECT_EQ(expected, 0);
 
     // Empty vector case
     CustomCXX::Vector<int> empty_vec;
-    EXPECT_EQ(empty_vec.rbegin(), empty_vec.end()); // Both should be _data
+    EXPECT_EQ(empty_vec.rbegin().base(), empty_vec.end());
 
     // Single element case
     CustomCXX::Vector<int> single_vec = {42};
     EXPECT_EQ(*single_vec.rbegin(), 42);
-    EXPECT_EQ(single_vec.rbegin(), single_vec.begin());
-    EXPECT_EQ(single_vec.rend(), single_vec.begin() - 1);
+    EXPECT_EQ(&*single_vec.rbegin(), single_vec.begin());
+    EXPECT_EQ(single_vec.rend().base(), single_vec.begin()); // No pointer before the storage
 }
 
 TEST(VectorTest, EmptyReverseRangeIsEmpty) {
@@ -287,6 +294,187 @@ TEST(VectorTest, TestVectorSort) {
     EXPECT_EQ(reverse_vec, Vector({5, 4, 3, 2, 1}));
 }
 
+TEST(VectorTest, SnapshotSharesStorage) {
+    CustomCXX::Vector<int> vec = {1, 2, 3};
+    const CustomCXX::Vector<int> snap = vec.snapshot();
+
+    EXPECT_TRUE(vec.is_shared());
+    EXPECT_TRUE(snap.is_shared());
+    EXPECT_EQ(snap.cbegin(), vec.cbegin()); // Same memory
+    EXPECT_EQ(snap, vec);
+}
+
+TEST(VectorTest, SnapshotClonesOnFirstWrite) {
+    CustomCXX::Vector<int> vec = {1, 2, 3};
+    CustomCXX::Vector<int> snap = vec.snapshot();
+
+    vec.push_back(4);
+    vec[0] = 10;
+    EXPECT_FALSE(vec.is_shared());
+    EXPECT_FALSE(snap.is_shared());
+    EXPECT_EQ(vec, CustomCXX::Vector<int>({10, 2, 3, 4}));
+    EXPECT_EQ(snap, CustomCXX::Vector<int>({1, 2, 3}));
+
+    // Writing through the snapshot leaves the original alone as well
+    CustomCXX::Vector<int> snap2 = vec.snapshot();
+    snap2.erase(0);
+    EXPECT_EQ(vec[0], 10);
+    EXPECT_EQ(snap2[0], 2);
+}
+
+TEST(VectorTest, SnapshotLastOwnerTakesStorageBack) {
+    CustomCXX::Vector<int> vec = {1, 2, 3};
+    const int* original = vec.cbegin();
+    {
+        CustomCXX::Vector<int> snap = vec.snapshot();
+        CustomCXX::Vector<int> moved = std::move(snap); // Moves keep sharing
+        EXPECT_TRUE(vec.is_shared());
+    }
+    EXPECT_FALSE(vec.is_shared());
+    vec[1] = 20; // No other owner left: written in place
+    EXPECT_EQ(vec.begin(), original);
+}
+
+TEST(VectorTest, SnapshotOutlivesOriginal) {
+    CustomCXX::Vector<int>* vec = new CustomCXX::Vector<int>({4, 5, 6});
+    CustomCXX::Vector<int> snap = vec->snapshot();
+    delete vec;
+    EXPECT_EQ(snap, CustomCXX::Vector<int>({4, 5, 6}));
+
+    CustomCXX::Vector<int> empty_vec;
+    CustomCXX::Vector<int> empty_snap = empty_vec.snapshot();
+    empty_snap.push_back(1);
+    EXPECT_EQ(empty_vec.size(), 0);
+    EXPECT_EQ(empty_snap.size(), 1);
+}
+
+TEST(VectorTest, SnapshotCopyAndClear) {
+    CustomCXX::Vector<int> vec = {1, 2, 3};
+    CustomCXX::Vector<int> snap = vec.snapshot();
+
+    CustomCXX::Vector<int> deep(snap); // Copies stay deep
+    EXPECT_FALSE(deep.is_shared());
+
+    snap.clear();
+    EXPECT_EQ(snap.size(), 0);
+    EXPECT_EQ(vec.size(), 3);
+    EXPECT_FALSE(vec.is_shared());
+
+    vec = snap.snapshot();
+    EXPECT_EQ(vec.size(), 0);
+}
+
+TEST(VectorTest, SnapshotInvalidatesEarlierMutableAccess) {
+    CustomCXX::Vector<int> vec = {1, 2, 3};
+    int* before = vec.begin();
+    CustomCXX::Vector<int> snap = vec.snapshot();
+
+    // Pointers taken before the snapshot now alias the shared storage
+    EXPECT_EQ(before, snap.cbegin());
+
+    // Mutable access obtained afterwards detaches, so writes stay private
+    int* after = vec.begin();
+    EXPECT_NE(after, before);
+    *after = 99;
+    EXPECT_EQ(snap[0], 1);
+    EXPECT_EQ(vec[0], 99);
+}
+
+TEST(VectorTest, SnapshotGrowWhileShared) {
+    CustomCXX::Vector<std::string> vec = {"a", "b"};
+    CustomCXX::Vector<std::string> snap = vec.snapshot();
+
+    vec.push_back("c"); // Full and shared: copied straight into the larger buffer
+    EXPECT_FALSE(vec.is_shared());
+    EXPECT_EQ(vec, (CustomCXX::Vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(snap, (CustomCXX::Vector<std::string>{"a", "b"}));
+
+    CustomCXX::Vector<std::string> snap2 = vec.snapshot();
+    vec.reserve(16);
+    vec.insert(0, "z");
+    EXPECT_EQ(vec[0], "z");
+    EXPECT_EQ(snap2.size(), 3);
+    EXPECT_EQ(snap2[0], "a");
+}
+
+TEST(VectorTest, SubscriptWriteClonesSnapshot) {
+    CustomCXX::Vector<int> vec = {1, 2, 3};
+    CustomCXX::Vector<int> snap = vec.snapshot();
+    vec[0] = 5; // First write clones
+    EXPECT_FALSE(vec.is_shared());
+    EXPECT_EQ(snap[0], 1); // Readable through a non-const snapshot
+    EXPECT_EQ(vec[0], 5);
+
+    // Reading through operator[] on either side never changes the other
+    CustomCXX::Vector<int> snap2 = vec.snapshot();
+    EXPECT_EQ(snap2[0], 5);
+    snap2[1] = 20;
+    EXPECT_EQ(vec[1], 2);
+    EXPECT_EQ(snap, (CustomCXX::Vector<int>{1, 2, 3}));
+}
+
+TEST(VectorTest, MovePushAndEmplaceBack) {
+    CustomCXX::Vector<std::string> vec;
+    std::string long_text(100, 'x');
+    vec.push_back(std::move(long_text));
+    EXPECT_EQ(vec[0], std::string(100, 'x'));
+
+    EXPECT_EQ(vec.emplace_back(3, 'y'), "yyy");
+    EXPECT_EQ(vec.size(), 2);
+
+    // Pushing an element of the Vector itself survives the reallocation
+    vec.push_back(vec[0]);
+    vec.push_back(vec[1]);
+    EXPECT_EQ(vec[2], std::string(100, 'x'));
+    EXPECT_EQ(vec[3], "yyy");
+}
+
+TEST(VectorTest, ConstIterators) {
+    CustomCXX::Vector<int> vec = {1, 2, 3};
+    const CustomCXX::Vector<int>& view = vec;
+
+    int sum = 0;
+    for (const int& x : view) {
+        sum += x;
+    }
+    EXPECT_EQ(sum, 6);
+    EXPECT_EQ(*view.rbegin(), 3);
+    EXPECT_EQ(view.cend() - view.cbegin(), 3);
+
+    // Reading a snapshot through const iterators does not copy it
+    CustomCXX::Vector<int> snap = vec.snapshot();
+    const CustomCXX::Vector<int>& const_snap = snap;
+    EXPECT_EQ(const_snap.begin(), view.begin());
+    EXPECT_TRUE(snap.is_shared());
+}
+
+TEST(VectorTest, Span) {
+    CustomCXX::Vector<int> vec = {1, 2, 3, 4, 5};
+    CustomCXX::Span<int> all = vec.span();
+    EXPECT_EQ(all.size(), 5);
+    EXPECT_EQ(all.data(), vec.begin());
+
+    CustomCXX::Span<int> middle = all.subspan(1, 3);
+    for (int& x : middle) {
+        x *= 10;
+    }
+    EXPECT_EQ(vec, (CustomCXX::Vector<int>{1, 20, 30, 40, 5}));
+
+    CustomCXX::View<int> view = middle; // Span<T> converts to Span<const T>
+    EXPECT_EQ(view.front(), 20);
+    EXPECT_EQ(*view.rbegin(), 40);
+    EXPECT_EQ(all.first(2).back(), 20);
+    EXPECT_EQ(all.last(1)[0], 5);
+    EXPECT_TRUE(all.subspan(5).empty());
+    EXPECT_THROW(all.subspan(2, 4), std::out_of_range);
+    EXPECT_THROW(view.at(3), std::out_of_range);
+
+    // A writable span detaches a snapshot first, so the snapshot is unaffected
+    CustomCXX::Vector<int> snap = vec.snapshot();
+    snap.span()[0] = -1;
+    EXPECT_EQ(vec[0], 1);
+}
+
 // Run all tests
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);